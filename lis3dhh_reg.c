@@ -18,6 +18,7 @@
   */
 
 #include "lis3dhh_reg.h"
+#include <string.h>
 
 /**
   * @defgroup  LIS3DHH
@@ -27,6 +28,196 @@
   *
   */
 
+/**
+  * @brief  Position of a writable control register: CTRL_REG1 to
+  *         CTRL_REG5 then FIFO_CTRL (same order as lis3dhh_shadow_t.reg).
+  *
+  * @param  reg   register address
+  * @retval       register index, -1 if the register is not writable
+  *
+  */
+static int32_t lis3dhh_cfg_index(uint8_t reg)
+{
+  int32_t idx;
+
+  if ((reg >= LIS3DHH_CTRL_REG1) && (reg <= LIS3DHH_CTRL_REG5))
+  {
+    idx = (int32_t)reg - (int32_t)LIS3DHH_CTRL_REG1;
+  }
+
+  else if (reg == LIS3DHH_FIFO_CTRL)
+  {
+    idx = (int32_t)LIS3DHH_SHADOW_NUM - 1;
+  }
+
+  else
+  {
+    idx = -1;
+  }
+
+  return idx;
+}
+
+#if defined(LIS3DHH_SHADOW_REG)
+
+/**
+  * @brief  Keep the shadow copy coherent with a completed bus transfer.
+  *         Single byte accesses refresh the register content, multiple
+  *         byte writes drop the whole copy. A CTRL_REG1 value with boot
+  *         or sw_reset set is never stored: those bits self-clear and
+  *         reload the default register values, so the copy is dropped
+  *         and loaded again from the device on next access.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   first register accessed
+  * @param  data  data transferred(ptr)
+  * @param  len   number of consecutive register accessed
+  * @param  wr    1 for write transfers, 0 for read transfers
+  *
+  */
+static void lis3dhh_shadow_update(stmdev_ctx_t *ctx, uint8_t reg,
+                                  const uint8_t *data, uint16_t len,
+                                  uint8_t wr)
+{
+  lis3dhh_shadow_t *shadow = (lis3dhh_shadow_t *)ctx->priv_data;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  int32_t idx;
+
+  if (shadow != NULL)
+  {
+    idx = lis3dhh_cfg_index(reg);
+
+    if (len != 1U)
+    {
+      if (wr == PROPERTY_ENABLE)
+      {
+        shadow->valid = 0U;
+      }
+    }
+
+    else if (idx < 0)
+    {
+      /* register not shadowed */
+    }
+
+    else if (reg == LIS3DHH_CTRL_REG1)
+    {
+      *(uint8_t *)&ctrl_reg1 = data[0];
+
+      if ((ctrl_reg1.boot != 0U) || (ctrl_reg1.sw_reset != 0U))
+      {
+        shadow->valid = 0U;
+      }
+
+      else
+      {
+        shadow->reg[idx] = data[0];
+        shadow->valid |= (uint8_t)(1U << (uint32_t)idx);
+      }
+    }
+
+    else
+    {
+      shadow->reg[idx] = data[0];
+      shadow->valid |= (uint8_t)(1U << (uint32_t)idx);
+    }
+  }
+}
+
+/**
+  * @brief  Refresh the shadow copy with registers transferred by a burst
+  *         access with address auto-increment.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   first register accessed
+  * @param  data  data transferred(ptr)
+  * @param  len   number of consecutive register accessed
+  *
+  */
+static void lis3dhh_shadow_store(stmdev_ctx_t *ctx, uint8_t reg,
+                                 const uint8_t *data, uint16_t len)
+{
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    lis3dhh_shadow_update(ctx, (uint8_t)(reg + i), &data[i], 1U,
+                          PROPERTY_ENABLE);
+  }
+}
+
+#endif /* LIS3DHH_SHADOW_REG */
+
+#if defined(LIS3DHH_TRACE)
+
+#ifndef LIS3DHH_TRACE_TIME
+#error "LIS3DHH_TRACE requires LIS3DHH_TRACE_TIME() to be defined"
+#endif /* LIS3DHH_TRACE_TIME */
+
+static lis3dhh_trace_t *lis3dhh_trace_ptr = NULL;
+
+/**
+  * @brief  Record a bus transaction in the attached trace.
+  *
+  * @param  ctx     read / write interface definitions(ptr)
+  * @param  reg     first register accessed
+  * @param  len     number of bytes
+  * @param  wr      PROPERTY_ENABLE for a write
+  * @param  status  interface status
+  * @param  start   LIS3DHH_TRACE_TIME() before the transaction
+  *
+  */
+static void lis3dhh_trace_record(const stmdev_ctx_t *ctx, uint8_t reg,
+                                 uint16_t len, uint8_t wr, int32_t status,
+                                 uint32_t start)
+{
+  lis3dhh_trace_t *tr = lis3dhh_trace_ptr;
+  lis3dhh_trace_entry_t *entry;
+  uint32_t dur = (uint32_t)LIS3DHH_TRACE_TIME() - start;
+  uint32_t head;
+  uint8_t dev = LIS3DHH_TRACE_DEV_NONE;
+  uint8_t b = 0U;
+  uint8_t i;
+
+  if (tr == NULL)
+  {
+    return;
+  }
+
+  for (i = 0U; i < tr->dev_num; i++)
+  {
+    if (tr->dev[i] == ctx)
+    {
+      dev = i;
+    }
+  }
+
+  head = tr->head;
+  entry = &tr->buff[head & tr->mask];
+  entry->time = start;
+  entry->dur = dur;
+  entry->status = status;
+  entry->len = len;
+  entry->reg = reg;
+  entry->wr = wr;
+  entry->dev = dev;
+  LIS3DHH_MEM_BARRIER();
+  tr->head = head + 1U;
+
+  while (((dur >> b) != 0U) && (b < (LIS3DHH_TRACE_BUCKETS - 1U)))
+  {
+    b++;
+  }
+
+  if ((dev != LIS3DHH_TRACE_DEV_NONE) &&
+      (reg >= LIS3DHH_WHO_AM_I) && (reg <= LIS3DHH_FIFO_SRC))
+  {
+    tr->hist[dev][reg - LIS3DHH_WHO_AM_I][b]++;
+  }
+}
+
+#endif /* LIS3DHH_TRACE */
+
 /**
   * @defgroup  LIS3DHH_Interfaces_Functions
   * @brief     This section provide a set of functions used to read and
@@ -51,9 +242,25 @@ int32_t lis3dhh_read_reg(stmdev_ctx_t *ctx, uint8_t reg,
                          uint16_t len)
 {
   int32_t ret;
+#if defined(LIS3DHH_TRACE)
+  uint32_t start = (uint32_t)LIS3DHH_TRACE_TIME();
+#endif /* LIS3DHH_TRACE */
 
   ret = ctx->read_reg(ctx->handle, reg, data, len);
 
+#if defined(LIS3DHH_TRACE)
+  lis3dhh_trace_record(ctx, reg, len, PROPERTY_DISABLE, ret, start);
+#endif /* LIS3DHH_TRACE */
+
+#if defined(LIS3DHH_SHADOW_REG)
+
+  if (ret == 0)
+  {
+    lis3dhh_shadow_update(ctx, reg, data, len, PROPERTY_DISABLE);
+  }
+
+#endif /* LIS3DHH_SHADOW_REG */
+
   return ret;
 }
 
@@ -72,32 +279,65 @@ int32_t lis3dhh_write_reg(stmdev_ctx_t *ctx, uint8_t reg,
                           uint16_t len)
 {
   int32_t ret;
+#if defined(LIS3DHH_TRACE)
+  uint32_t start = (uint32_t)LIS3DHH_TRACE_TIME();
+#endif /* LIS3DHH_TRACE */
 
   ret = ctx->write_reg(ctx->handle, reg, data, len);
 
+#if defined(LIS3DHH_TRACE)
+  lis3dhh_trace_record(ctx, reg, len, PROPERTY_ENABLE, ret, start);
+#endif /* LIS3DHH_TRACE */
+
+#if defined(LIS3DHH_SHADOW_REG)
+
+  if (ret == 0)
+  {
+    lis3dhh_shadow_update(ctx, reg, data, len, PROPERTY_ENABLE);
+  }
+
+#endif /* LIS3DHH_SHADOW_REG */
+
   return ret;
 }
 
 /**
-  * @}
+  * @brief  Read a configuration register, from the shadow copy when
+  *         available or from the device otherwise.
   *
-  */
-
-/**
-  * @defgroup    LIS3DHH_Sensitivity
-  * @brief       These functions convert raw-data into engineering units.
-  * @{
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   register to read
+  * @param  data  pointer to buffer that store the data read(ptr)
+  * @param  len   number of consecutive register to read
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-
-float_t lis3dhh_from_lsb_to_mg(int16_t lsb)
+static int32_t lis3dhh_read_cfg(stmdev_ctx_t *ctx, uint8_t reg,
+                                uint8_t *data,
+                                uint16_t len)
 {
-  return ((float_t)lsb * 0.076f);
-}
+  int32_t ret;
+#if defined(LIS3DHH_SHADOW_REG)
+  lis3dhh_shadow_t *shadow = (lis3dhh_shadow_t *)ctx->priv_data;
+  int32_t idx = lis3dhh_cfg_index(reg);
 
-float_t lis3dhh_from_lsb_to_celsius(int16_t lsb)
-{
-  return (((float_t)lsb / 16.0f) + 25.0f);
+  if ((shadow != NULL) && (len == 1U) && (idx >= 0) &&
+      ((shadow->valid & (1U << (uint32_t)idx)) != 0U))
+  {
+    data[0] = shadow->reg[idx];
+    ret = 0;
+  }
+
+  else
+  {
+    ret = lis3dhh_read_reg(ctx, reg, data, len);
+  }
+
+#else
+  ret = lis3dhh_read_reg(ctx, reg, data, len);
+#endif /* LIS3DHH_SHADOW_REG */
+
+  return ret;
 }
 
 /**
@@ -105,456 +345,584 @@ float_t lis3dhh_from_lsb_to_celsius(int16_t lsb)
   *
   */
 
+#if defined(LIS3DHH_SHADOW_REG)
+
 /**
-  * @defgroup   LIS3DHH_Data_generation
-  * @brief      This section groups all the functions concerning data
-  *             generation
+  * @defgroup    LIS3DHH_Shadow_registers
+  * @brief       These functions manage the RAM copy of the control
+  *              registers.
   * @{
   *
   */
 
 /**
-  * @brief  Blockdataupdate.[set]
+  * @brief  Attach a shadow copy of the control registers to the context.
+  *         The copy is loaded from the device on first access of each
+  *         register. Pass NULL to detach it.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of bdu in reg CTRL_REG1.
+  * @param  val    Shadow copy storage, NULL to detach.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_block_data_update_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_shadow_attach(stmdev_ctx_t *ctx, lis3dhh_shadow_t *val)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-
-  if (ret == 0)
+  if (val != NULL)
   {
-    ctrl_reg1.bdu = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+    val->valid = 0U;
   }
 
-  return ret;
+  ctx->priv_data = val;
+
+  return 0;
 }
 
 /**
-  * @brief  Blockdataupdate.[get]
+  * @brief  Drop the shadow copy content, registers are read again from
+  *         the device on next access. To be used if the device is
+  *         configured outside of the driver or powered off.
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of bdu in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_block_data_update_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_shadow_invalidate(stmdev_ctx_t *ctx)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
+  lis3dhh_shadow_t *shadow = (lis3dhh_shadow_t *)ctx->priv_data;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-  *val = ctrl_reg1.bdu;
+  if (shadow != NULL)
+  {
+    shadow->valid = 0U;
+  }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Output data rate selection.[set]
+  * @}
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of norm_mod_en in reg CTRL_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  */
+
+#endif /* LIS3DHH_SHADOW_REG */
+
+#if defined(LIS3DHH_TRACE)
+
+/**
+  * @defgroup    LIS3DHH_Bus_trace
+  * @brief       These functions manage the record of the bus transactions.
+  * @{
   *
   */
-int32_t lis3dhh_data_rate_set(stmdev_ctx_t *ctx,
-                              lis3dhh_norm_mod_en_t val)
+
+/**
+  * @brief  Initialize a trace.
+  *
+  * @param  tr      Trace.(ptr)
+  * @param  buff    Storage for the last transactions.(ptr)
+  * @param  size    Number of entries of buff, MUST be a power of 2.
+  * @retval         0 -> no Error, -1 -> size is not a power of 2.
+  *
+  */
+int32_t lis3dhh_trace_init(lis3dhh_trace_t *tr,
+                           lis3dhh_trace_entry_t *buff, uint16_t size)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
+  uint8_t d;
+  uint8_t i;
+  uint8_t j;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  if ((size == 0U) || ((size & (size - 1U)) != 0U))
+  {
+    return -1;
+  }
 
-  if (ret == 0)
+  tr->buff = buff;
+  tr->mask = size - 1U;
+  tr->head = 0U;
+  tr->dev_num = 0U;
+
+  for (d = 0U; d < LIS3DHH_TRACE_DEV_NUM; d++)
   {
-    ctrl_reg1.norm_mod_en = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+    tr->dev[d] = NULL;
+
+    for (i = 0U; i < LIS3DHH_TRACE_REG_NUM; i++)
+    {
+      for (j = 0U; j < LIS3DHH_TRACE_BUCKETS; j++)
+      {
+        tr->hist[d][i][j] = 0U;
+      }
+    }
   }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Output data rate selection.[get]
+  * @brief  Register a context in a trace, so that its transactions are
+  *         tagged with a device id. To be called before attaching the
+  *         trace.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of norm_mod_en in reg CTRL_REG1.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  tr      Trace.(ptr)
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  id      Device id, 0 to LIS3DHH_TRACE_DEV_NUM - 1.(ptr)
+  * @retval         0 -> no Error, -1 -> LIS3DHH_TRACE_DEV_NUM contexts
+  *                 already registered.
   *
   */
-int32_t lis3dhh_data_rate_get(stmdev_ctx_t *ctx,
-                              lis3dhh_norm_mod_en_t *val)
+int32_t lis3dhh_trace_dev_add(lis3dhh_trace_t *tr, const stmdev_ctx_t *ctx,
+                              uint8_t *id)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  uint8_t i;
 
-  switch (ctrl_reg1.norm_mod_en)
+  for (i = 0U; i < tr->dev_num; i++)
   {
-    case LIS3DHH_POWER_DOWN:
-      *val = LIS3DHH_POWER_DOWN;
-      break;
+    if (tr->dev[i] == ctx)
+    {
+      *id = i;
 
-    case LIS3DHH_1kHz1:
-      *val = LIS3DHH_1kHz1;
-      break;
+      return 0;
+    }
+  }
 
-    default:
-      *val = LIS3DHH_POWER_DOWN;
-      break;
+  if (tr->dev_num >= LIS3DHH_TRACE_DEV_NUM)
+  {
+    return -1;
   }
 
-  return ret;
+  tr->dev[tr->dev_num] = ctx;
+  *id = tr->dev_num;
+  tr->dev_num++;
+
+  return 0;
 }
 
 /**
-  * @brief  Temperature output value.[get]
+  * @brief  Start recording the bus transactions in a trace.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  tr      Trace, NULL to stop recording.(ptr)
   *
   */
-int32_t lis3dhh_temperature_raw_get(stmdev_ctx_t *ctx, int16_t *val)
+void lis3dhh_trace_attach(lis3dhh_trace_t *tr)
 {
-  uint8_t buff[2];
-  int32_t ret;
+  lis3dhh_trace_ptr = tr;
+}
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_TEMP_L, buff, 2);
-  *val = (int16_t)buff[1];
-  *val = (*val * 256) + (int16_t)buff[0];
+/**
+  * @brief  Copy the entries recorded since a sequence number.
+  *         Entries overwritten before being read are skipped, so the
+  *         function can be called from a context other than the bus one
+  *         (e.g. a logging task) without locks. The oldest slot may be
+  *         under rewrite at any time, so at most size - 1 entries are
+  *         returned.
+  *
+  * @param  tr      Trace.(ptr)
+  * @param  seq     Sequence number of the next entry to read, updated;
+  *                 start from 0.(ptr)
+  * @param  val     Buffer of max entries.(ptr)
+  * @param  max     Maximum number of entries to copy.
+  * @retval         Number of entries copied.
+  *
+  */
+uint16_t lis3dhh_trace_read(lis3dhh_trace_t *tr, uint32_t *seq,
+                            lis3dhh_trace_entry_t *val, uint16_t max)
+{
+  uint32_t size = (uint32_t)tr->mask + 1U;
+  uint32_t head = tr->head;
+  uint32_t first = *seq;
+  uint16_t num = 0U;
+  uint16_t i;
 
-  return ret;
+  LIS3DHH_MEM_BARRIER();
+
+  if ((head - first) > size)
+  {
+    first = head - size;
+  }
+
+  while ((num < max) && ((first + num) != head))
+  {
+    val[num] = tr->buff[(first + num) & tr->mask];
+    num++;
+  }
+
+  LIS3DHH_MEM_BARRIER();
+
+  /* drop the entries overwritten while copying: the slot of sequence
+   * head - size is being written before head is incremented */
+  head = tr->head;
+
+  if ((head - first) >= size)
+  {
+    i = (uint16_t)(head - first - size + 1U);
+    i = (i > num) ? num : i;
+    num -= i;
+
+    if (num > 0U)
+    {
+      (void)memmove(val, &val[i], num * sizeof(lis3dhh_trace_entry_t));
+    }
+
+    first += i;
+  }
+
+  *seq = first + num;
+
+  return num;
 }
 
 /**
-  * @brief  acceleration output value.[get]
+  * @brief  Unsigned value in decimal.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  v       value
+  * @param  buff    buffer of at least 10 characters(ptr)
+  * @retval         number of characters written
   *
   */
-int32_t lis3dhh_acceleration_raw_get(stmdev_ctx_t *ctx, int16_t *val)
+static uint16_t lis3dhh_trace_dec(uint32_t v, char *buff)
 {
-  uint8_t buff[6];
-  int32_t ret;
+  char tmp[10];
+  uint16_t len = 0U;
+  uint8_t n = 0U;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_X_L_XL, buff, 6);
-  val[0] = (int16_t)buff[1];
-  val[0] = (val[0] * 256) + (int16_t)buff[0];
-  val[1] = (int16_t)buff[3];
-  val[1] = (val[1] * 256) + (int16_t)buff[2];
-  val[2] = (int16_t)buff[5];
-  val[2] = (val[2] * 256) + (int16_t)buff[4];
+  do
+  {
+    tmp[n] = (char)('0' + (char)(v % 10U));
+    v /= 10U;
+    n++;
+  } while (v != 0U);
 
-  return ret;
+  while (n > 0U)
+  {
+    n--;
+    buff[len] = tmp[n];
+    len++;
+  }
+
+  return len;
 }
 
 /**
-  * @brief  Acceleration set of data available.[get]
+  * @brief  Register address in hexadecimal, "0x" prefixed.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of zyxda in reg STATUS.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  reg     register address
+  * @param  buff    buffer of at least 4 characters(ptr)
+  * @retval         number of characters written
   *
   */
-int32_t lis3dhh_xl_data_ready_get(stmdev_ctx_t *ctx, uint8_t *val)
+static uint16_t lis3dhh_trace_hex(uint8_t reg, char *buff)
 {
-  lis3dhh_status_t status;
-  int32_t ret;
+  const char hex[] = "0123456789abcdef";
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *)&status, 1);
-  *val = status.zyxda;
+  buff[0] = '0';
+  buff[1] = 'x';
+  buff[2] = hex[reg >> 4];
+  buff[3] = hex[reg & 0x0FU];
 
-  return ret;
+  return 4U;
 }
 
 /**
-  * @brief  Acceleration set of data overrun.[get]
+  * @brief  Trace entry as a CSV line:
+  *         time,dev,reg,dir,len,status,dur followed by a new line, with
+  *         reg in hexadecimal and dir "r" or "w" (dev is 255 for a context
+  *         not registered).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of zyxor in reg STATUS.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  val     Trace entry.(ptr)
+  * @param  buff    Buffer of LIS3DHH_TRACE_CSV_LEN characters, the line is
+  *                 null terminated.(ptr)
+  * @retval         Length of the line.
   *
   */
-int32_t lis3dhh_xl_data_ovr_get(stmdev_ctx_t *ctx, uint8_t *val)
+uint16_t lis3dhh_trace_csv_get(const lis3dhh_trace_entry_t *val,
+                               char *buff)
 {
-  lis3dhh_status_t status;
-  int32_t ret;
+  uint16_t len;
+
+  len = lis3dhh_trace_dec(val->time, buff);
+  buff[len] = ',';
+  len++;
+  len += lis3dhh_trace_dec(val->dev, &buff[len]);
+  buff[len] = ',';
+  len++;
+  len += lis3dhh_trace_hex(val->reg, &buff[len]);
+  buff[len] = ',';
+  buff[len + 1U] = (val->wr != 0U) ? 'w' : 'r';
+  buff[len + 2U] = ',';
+  len += 3U;
+  len += lis3dhh_trace_dec(val->len, &buff[len]);
+  buff[len] = ',';
+  len++;
+
+  if (val->status < 0)
+  {
+    buff[len] = '-';
+    len++;
+    len += lis3dhh_trace_dec(0U - (uint32_t)val->status, &buff[len]);
+  }
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *)&status, 1);
-  *val = status.zyxor;
+  else
+  {
+    len += lis3dhh_trace_dec((uint32_t)val->status, &buff[len]);
+  }
 
-  return ret;
+  buff[len] = ',';
+  len++;
+  len += lis3dhh_trace_dec(val->dur, &buff[len]);
+  buff[len] = '\n';
+  buff[len + 1U] = '\0';
+
+  return len + 1U;
 }
 
 /**
-  * @}
+  * @brief  Latency histogram of a register of a device as a CSV line:
+  *         dev,reg followed by the LIS3DHH_TRACE_BUCKETS counters and a
+  *         new line, with reg in hexadecimal. Bucket 0 counts durations of 0
+  *         ticks, bucket k durations in [2^(k-1), 2^k), the last bucket
+  *         also the longer ones.
+  *
+  * @param  tr      Trace.(ptr)
+  * @param  dev     Device id, see lis3dhh_trace_dev_add.
+  * @param  reg     Register address, LIS3DHH_WHO_AM_I to LIS3DHH_FIFO_SRC.
+  * @param  buff    Buffer of LIS3DHH_TRACE_HIST_CSV_LEN characters, the
+  *                 line is null terminated.(ptr)
+  * @retval         Length of the line, 0 if dev or reg is out of range.
   *
   */
+uint16_t lis3dhh_trace_hist_csv_get(const lis3dhh_trace_t *tr, uint8_t dev,
+                                    uint8_t reg, char *buff)
+{
+  uint16_t len;
+  uint8_t i;
 
-/**
-  * @defgroup  LIS3DHH_common
-  * @brief     This section group common useful functions
-  * @{
-  *
-  */
+  if ((dev >= LIS3DHH_TRACE_DEV_NUM) ||
+      (reg < LIS3DHH_WHO_AM_I) || (reg > LIS3DHH_FIFO_SRC))
+  {
+    buff[0] = '\0';
 
-/**
-  * @brief  DeviceWhoamI.[get]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  buff   Buffer that stores data read
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
-  *
-  */
-int32_t lis3dhh_device_id_get(stmdev_ctx_t *ctx, uint8_t *buff)
-{
-  int32_t ret;
+    return 0U;
+  }
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_WHO_AM_I, buff, 1);
+  len = lis3dhh_trace_dec(dev, buff);
+  buff[len] = ',';
+  len++;
+  len += lis3dhh_trace_hex(reg, &buff[len]);
 
-  return ret;
+  for (i = 0U; i < LIS3DHH_TRACE_BUCKETS; i++)
+  {
+    buff[len] = ',';
+    len++;
+    len += lis3dhh_trace_dec(tr->hist[dev][reg - LIS3DHH_WHO_AM_I][i],
+                             &buff[len]);
+  }
+
+  buff[len] = '\n';
+  buff[len + 1U] = '\0';
+
+  return len + 1U;
 }
 
 /**
-  * @brief  Software reset. Restore the default values in user registers.[set]
-  *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of sw_reset in reg CTRL_REG1.
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @}
   *
   */
-int32_t lis3dhh_reset_set(stmdev_ctx_t *ctx, uint8_t val)
-{
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+#endif /* LIS3DHH_TRACE */
 
-  if (ret == 0)
-  {
-    ctrl_reg1.sw_reset = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-  }
+/**
+  * @defgroup    LIS3DHH_Sensitivity
+  * @brief       These functions convert raw-data into engineering units.
+  * @{
+  *
+  */
 
-  return ret;
+float_t lis3dhh_from_lsb_to_mg(int16_t lsb)
+{
+  return ((float_t)lsb * 0.076f);
+}
+
+float_t lis3dhh_from_lsb_to_celsius(int16_t lsb)
+{
+  return (((float_t)lsb / 16.0f) + 25.0f);
 }
 
 /**
-  * @brief  Software reset. Restore the default values in user registers.[get]
+  * @brief  Convert an array of acceleration raw values in mg.
+  *         Results are identical to lis3dhh_from_lsb_to_mg; the loop has
+  *         no calls nor branches so that it can be vectorized by the
+  *         compiler on targets providing SIMD units.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of sw_reset in reg CTRL_REG1.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  in     Raw values.(ptr)
+  * @param  out    Converted values, may not overlap in.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_reset_get(stmdev_ctx_t *ctx, uint8_t *val)
+void lis3dhh_from_lsb_to_mg_array(const int16_t *in, float_t *out,
+                                  size_t n)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-  *val = ctrl_reg1.sw_reset;
+  size_t i;
 
-  return ret;
+  for (i = 0U; i < n; i++)
+  {
+    out[i] = (float_t)in[i] * 0.076f;
+  }
 }
 
 /**
-  * @brief  Reboot memory content. Reload the calibration parameters.[set]
+  * @brief  Convert an array of temperature raw values in Celsius degrees.
+  *         Results are identical to lis3dhh_from_lsb_to_celsius.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of boot in reg CTRL_REG1
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  in     Raw values.(ptr)
+  * @param  out    Converted values, may not overlap in.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_boot_set(stmdev_ctx_t *ctx, uint8_t val)
+void lis3dhh_from_lsb_to_celsius_array(const int16_t *in, float_t *out,
+                                       size_t n)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  size_t i;
 
-  if (ret == 0)
+  for (i = 0U; i < n; i++)
   {
-    ctrl_reg1.boot = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+    out[i] = ((float_t)in[i] / 16.0f) + 25.0f;
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Reboot memory content. Reload the calibration parameters.[get]
+  * @brief  Convert an acceleration raw value in micro-g (integer).
+  *         Sensitivity is exactly 76 ug/LSB, so no rounding is involved
+  *         and the result is lis3dhh_from_lsb_to_mg() * 1000 rounded to
+  *         the nearest integer.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of boot in reg CTRL_REG1.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  lsb    Raw value.
+  * @retval        Acceleration in ug.
   *
   */
-int32_t lis3dhh_boot_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_from_lsb_to_ug(int16_t lsb)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-  *val = ctrl_reg1.boot;
-
-  return ret;
+  return ((int32_t)lsb * 76);
 }
 
 /**
-  * @brief  Selftest.[set]
+  * @brief  Convert an acceleration raw value in mg, Q16.16 fixed point.
+  *         The exact value lsb * 0.076 * 65536 = lsb * 4980.736 is
+  *         rounded to the nearest integer, halves away from zero.
+  *         lis3dhh_from_lsb_to_mg uses 0.076f, which is not exactly
+  *         0.076, and rounds the product to float: scaled by 65536 it
+  *         differs from this result by up to 13 LSB (0.0002 mg).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of st in reg CTRL_REG4
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  lsb    Raw value.
+  * @retval        Acceleration in mg, 16 fractional bits.
   *
   */
-int32_t lis3dhh_self_test_set(stmdev_ctx_t *ctx, lis3dhh_st_t val)
+int32_t lis3dhh_from_lsb_to_mg_q16(int16_t lsb)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
+  int32_t frac;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  /* 4980.736 = 4980 + 92 / 125 */
+  frac = (int32_t)lsb * 92;
 
-  if (ret == 0)
+  if (frac >= 0)
   {
-    ctrl_reg4.st = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+    frac = (frac + 62) / 125;
   }
 
-  return ret;
+  else
+  {
+    frac = -((62 - frac) / 125);
+  }
+
+  return (((int32_t)lsb * 4980) + frac);
 }
 
 /**
-  * @brief  Selftest.[get]
+  * @brief  Convert a temperature raw value in hundredths of Celsius
+  *         degree. The exact value (lsb / 16 + 25) * 100 is rounded to
+  *         the nearest integer, halves away from zero, so the result is
+  *         lis3dhh_from_lsb_to_celsius() * 100 rounded the same way.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of st in reg CTRL_REG4.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  lsb    Raw value.
+  * @retval        Temperature in 0.01 Celsius degrees.
   *
   */
-int32_t lis3dhh_self_test_get(stmdev_ctx_t *ctx, lis3dhh_st_t *val)
+int32_t lis3dhh_from_lsb_to_centicelsius(int16_t lsb)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
+  int32_t val;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  /* (lsb / 16 + 25) * 100 = (lsb * 25 + 10000) / 4 */
+  val = ((int32_t)lsb * 25) + 10000;
 
-  switch (ctrl_reg4.st)
+  if (val >= 0)
   {
-    case LIS3DHH_ST_DISABLE:
-      *val = LIS3DHH_ST_DISABLE;
-      break;
-
-    case LIS3DHH_ST_POSITIVE:
-      *val = LIS3DHH_ST_POSITIVE;
-      break;
-
-    case LIS3DHH_ST_NEGATIVE:
-      *val = LIS3DHH_ST_NEGATIVE;
-      break;
+    val = (val + 2) / 4;
+  }
 
-    default:
-      *val = LIS3DHH_ST_DISABLE;
-      break;
+  else
+  {
+    val = -((2 - val) / 4);
   }
 
-  return ret;
+  return val;
 }
 
 /**
-  * @brief  Digital filtering Phase/bandwidth selection.[set]
+  * @brief  Convert an array of acceleration raw values in micro-g.
+  *         Results are identical to lis3dhh_from_lsb_to_ug.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of dsp in reg CTRL_REG4
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  in     Raw values.(ptr)
+  * @param  out    Converted values.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_filter_config_set(stmdev_ctx_t *ctx,
-                                  lis3dhh_dsp_t val)
+void lis3dhh_from_lsb_to_ug_array(const int16_t *in, int32_t *out,
+                                  size_t n)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
+  size_t i;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
-
-  if (ret == 0)
+  for (i = 0U; i < n; i++)
   {
-    ctrl_reg4.dsp = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+    out[i] = (int32_t)in[i] * 76;
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Digital filtering Phase/bandwidth selection.[get]
+  * @brief  Convert an array of acceleration raw values in mg, Q16.16.
+  *         Results are identical to lis3dhh_from_lsb_to_mg_q16.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of dsp in reg CTRL_REG4.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  in     Raw values.(ptr)
+  * @param  out    Converted values.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_filter_config_get(stmdev_ctx_t *ctx,
-                                  lis3dhh_dsp_t *val)
+void lis3dhh_from_lsb_to_mg_q16_array(const int16_t *in, int32_t *out,
+                                      size_t n)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
-  int32_t ret;
+  size_t i;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
-
-  switch (ctrl_reg4.dsp)
+  for (i = 0U; i < n; i++)
   {
-    case LIS3DHH_LINEAR_PHASE_440Hz:
-      *val = LIS3DHH_LINEAR_PHASE_440Hz;
-      break;
-
-    case LIS3DHH_LINEAR_PHASE_235Hz:
-      *val = LIS3DHH_LINEAR_PHASE_235Hz;
-      break;
-
-    case LIS3DHH_NO_LINEAR_PHASE_440Hz:
-      *val = LIS3DHH_NO_LINEAR_PHASE_440Hz;
-      break;
-
-    case LIS3DHH_NO_LINEAR_PHASE_235Hz:
-      *val = LIS3DHH_NO_LINEAR_PHASE_235Hz;
-      break;
-
-    default:
-      *val = LIS3DHH_LINEAR_PHASE_440Hz;
-      break;
+    out[i] = lis3dhh_from_lsb_to_mg_q16(in[i]);
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Statusregister.[get]
+  * @brief  Convert an array of temperature raw values in hundredths of
+  *         Celsius degree.
+  *         Results are identical to lis3dhh_from_lsb_to_centicelsius.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get registers STATUS.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  in     Raw values.(ptr)
+  * @param  out    Converted values.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_status_get(stmdev_ctx_t *ctx, lis3dhh_status_t *val)
+void lis3dhh_from_lsb_to_centicelsius_array(const int16_t *in,
+                                            int32_t *out, size_t n)
 {
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *) val, 1);
+  size_t i;
 
-  return ret;
+  for (i = 0U; i < n; i++)
+  {
+    out[i] = lis3dhh_from_lsb_to_centicelsius(in[i]);
+  }
 }
 
 /**
@@ -563,31 +931,31 @@ int32_t lis3dhh_status_get(stmdev_ctx_t *ctx, lis3dhh_status_t *val)
   */
 
 /**
-  * @defgroup  LIS3DHH_interrupts
-  * @brief     This section group all the functions that manage interrupts
+  * @defgroup   LIS3DHH_Data_generation
+  * @brief      This section groups all the functions concerning data
+  *             generation
   * @{
   *
   */
 
 /**
-  * @brief  DRDY latched / pulsed, pulse duration is 1/4 ODR.[set]
+  * @brief  Blockdataupdate.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of drdy_pulse in reg CTRL_REG1
+  * @param  val    Change the values of bdu in reg CTRL_REG1.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_drdy_notification_mode_set(stmdev_ctx_t *ctx,
-                                           lis3dhh_drdy_pulse_t val)
+int32_t lis3dhh_block_data_update_set(stmdev_ctx_t *ctx, uint8_t val)
 {
   lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
   if (ret == 0)
   {
-    ctrl_reg1.drdy_pulse = (uint8_t)val;
+    ctrl_reg1.bdu = val;
     ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
   }
 
@@ -595,94 +963,77 @@ int32_t lis3dhh_drdy_notification_mode_set(stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief   DRDY latched / pulsed, pulse duration is 1/4 ODR.[get]
+  * @brief  Blockdataupdate.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of drdy_pulse in reg CTRL_REG1.(ptr)
+  * @param  val    Get the values of bdu in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_drdy_notification_mode_get(stmdev_ctx_t *ctx,
-                                           lis3dhh_drdy_pulse_t *val)
+int32_t lis3dhh_block_data_update_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
   lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-
-  switch (ctrl_reg1.drdy_pulse)
-  {
-    case LIS3DHH_LATCHED:
-      *val = LIS3DHH_LATCHED;
-      break;
-
-    case LIS3DHH_PULSED:
-      *val = LIS3DHH_PULSED;
-      break;
-
-    default:
-      *val = LIS3DHH_LATCHED;
-      break;
-  }
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  *val = ctrl_reg1.bdu;
 
   return ret;
 }
 
 /**
-  * @brief  It configures the INT1 pad as output for FIFO flags or as
-  *                external asynchronous input trigger to FIFO.[set]
+  * @brief  Output data rate selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_ext in reg INT1_CTRL
+  * @param  val    Change the values of norm_mod_en in reg CTRL_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_int1_mode_set(stmdev_ctx_t *ctx,
-                              lis3dhh_int1_ext_t val)
+int32_t lis3dhh_data_rate_set(stmdev_ctx_t *ctx,
+                              lis3dhh_norm_mod_en_t val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
   if (ret == 0)
   {
-    int1_ctrl.int1_ext = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+    ctrl_reg1.norm_mod_en = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  It configures the INT1 pad as output for FIFO flags or as
-  *                external asynchronous input trigger to FIFO.[get]
+  * @brief  Output data rate selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_ext in reg INT1_CTRL.(ptr)
+  * @param  val    Get the values of norm_mod_en in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_int1_mode_get(stmdev_ctx_t *ctx,
-                              lis3dhh_int1_ext_t *val)
+int32_t lis3dhh_data_rate_get(stmdev_ctx_t *ctx,
+                              lis3dhh_norm_mod_en_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
-  switch (int1_ctrl.int1_ext)
+  switch (ctrl_reg1.norm_mod_en)
   {
-    case LIS3DHH_PIN_AS_INTERRUPT:
-      *val = LIS3DHH_PIN_AS_INTERRUPT;
+    case LIS3DHH_POWER_DOWN:
+      *val = LIS3DHH_POWER_DOWN;
       break;
 
-    case LIS3DHH_PIN_AS_TRIGGER:
-      *val = LIS3DHH_PIN_AS_TRIGGER;
+    case LIS3DHH_1kHz1:
+      *val = LIS3DHH_1kHz1;
       break;
 
     default:
-      *val = LIS3DHH_PIN_AS_INTERRUPT;
+      *val = LIS3DHH_POWER_DOWN;
       break;
   }
 
@@ -690,498 +1041,573 @@ int32_t lis3dhh_int1_mode_get(stmdev_ctx_t *ctx,
 }
 
 /**
-  * @brief  FIFO watermark status on INT1 pin.[set]
+  * @brief  Temperature output value.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_fth in reg INT1_CTRL
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_threshold_on_int1_set(stmdev_ctx_t *ctx,
-                                           uint8_t val)
+int32_t lis3dhh_temperature_raw_get(stmdev_ctx_t *ctx, int16_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  uint8_t buff[2];
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-
-  if (ret == 0)
-  {
-    int1_ctrl.int1_fth = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_TEMP_L, buff, 2);
+  lis3dhh_temperature_raw_decode(buff, val);
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark status on INT1 pin.[get]
+  * @brief  acceleration output value.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_fth in reg INT1_CTRL.(ptr)
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_threshold_on_int1_get(stmdev_ctx_t *ctx,
-                                           uint8_t *val)
+int32_t lis3dhh_acceleration_raw_get(stmdev_ctx_t *ctx, int16_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  uint8_t buff[6];
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  *val = int1_ctrl.int1_fth;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_X_L_XL, buff, 6);
+  lis3dhh_acceleration_raw_decode(buff, val);
 
   return ret;
 }
 
 /**
-  * @brief  FIFO full flag on INT1 pin.[set]
+  * @brief  Temperature output value from the bytes of OUT_TEMP_L and
+  *         OUT_TEMP_H. To be used when the 2 bytes transfer from
+  *         OUT_TEMP_L is done outside of the driver (e.g. by DMA).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_fss5 in reg INT1_CTRL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   Bytes read from OUT_TEMP_L.(ptr)
+  * @param  val    Temperature raw value.(ptr)
   *
   */
-int32_t lis3dhh_fifo_full_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
+void lis3dhh_temperature_raw_decode(const uint8_t *buff, int16_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-
-  if (ret == 0)
-  {
-    int1_ctrl.int1_fss5 = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
-
-  return ret;
+  lis3dhh_raw_decode(buff, val, 1U);
 }
 
 /**
-  * @brief  FIFO full flag on INT1 pin.[get]
+  * @brief  Acceleration output value from the bytes of OUT_X_L_XL to
+  *         OUT_Z_H_XL. To be used when the 6 bytes transfer from
+  *         OUT_X_L_XL is done outside of the driver (e.g. by DMA).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_fss5 in reg INT1_CTRL.(ptr)
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   Bytes read from OUT_X_L_XL.(ptr)
+  * @param  val    Acceleration raw values, X, Y, Z.(ptr)
   *
   */
-int32_t lis3dhh_fifo_full_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
+void lis3dhh_acceleration_raw_decode(const uint8_t *buff, int16_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  *val = int1_ctrl.int1_fss5;
-
-  return ret;
+  lis3dhh_raw_decode(buff, val, 3U);
 }
 
 /**
-  * @brief  FIFO overrun interrupt on INT1 pin.[set]
+  * @brief  Raw values from little endian output register bytes.
+  *         On little endian targets the bytes are already in int16_t
+  *         layout and are just copied (nothing is done when decoding in
+  *         place), otherwise each value is assembled from its two bytes.
+  *         buff and val may be the same buffer.
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_ovr in reg INT1_CTRL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   Bytes read from output registers, LSB first.(ptr)
+  * @param  val    Raw values.(ptr)
+  * @param  n      Number of values.
   *
   */
-int32_t lis3dhh_fifo_ovr_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
+void lis3dhh_raw_decode(const uint8_t *buff, int16_t *val, size_t n)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
-  int32_t ret;
+#if DRV_BYTE_ORDER == DRV_LITTLE_ENDIAN
+
+  if ((const uint8_t *)val != buff)
+  {
+    (void)memmove(val, buff, n * 2U);
+  }
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+#else
+  size_t i;
+  uint8_t lsb;
+  uint8_t msb;
 
-  if (ret == 0)
+  for (i = 0U; i < n; i++)
   {
-    int1_ctrl.int1_ovr = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+    lsb = buff[2U * i];
+    msb = buff[(2U * i) + 1U];
+    val[i] = (int16_t)msb;
+    val[i] = (val[i] * 256) + (int16_t)lsb;
   }
 
-  return ret;
+#endif /* DRV_BYTE_ORDER */
 }
 
 /**
-  * @brief  FIFO overrun interrupt on INT1 pin.[get]
+  * @brief  Acceleration set of data available.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_ovr in reg INT1_CTRL.(ptr)
+  * @param  val    Get the values of zyxda in reg STATUS.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_ovr_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_xl_data_ready_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  lis3dhh_status_t status;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  *val = int1_ctrl.int1_ovr;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *)&status, 1);
+  *val = status.zyxda;
 
   return ret;
 }
 
 /**
-  * @brief  BOOT status on INT1 pin.[set]
+  * @brief  Acceleration set of data overrun.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_boot in reg INT1_CTRL
+  * @param  val    Get the values of zyxor in reg STATUS.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_boot_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_xl_data_ovr_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  lis3dhh_status_t status;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-
-  if (ret == 0)
-  {
-    int1_ctrl.int1_boot = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *)&status, 1);
+  *val = status.zyxor;
 
   return ret;
 }
 
 /**
-  * @brief  BOOT status on INT1 pin.[get]
+  * @brief  Temperature, status and acceleration output values read
+  *         together from OUT_TEMP_L to OUT_Z_H_XL.[get]
+  *         A single transaction is used, so the values are coherent in
+  *         time (if_add_inc in reg CTRL_REG1 MUST be set).
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_boot in reg INT1_CTRL.(ptr)
+  * @param  val    Temperature, STATUS and acceleration raw data.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_boot_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_snapshot_raw_get(stmdev_ctx_t *ctx,
+                                 lis3dhh_snapshot_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
+  uint8_t buff[9];
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  *val = int1_ctrl.int1_boot;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_TEMP_L, buff, 9);
+  lis3dhh_snapshot_raw_decode(buff, val);
 
   return ret;
 }
 
 /**
-  * @brief  Data-ready signal on INT1 pin.[set]
+  * @brief  Temperature, status and acceleration output values from the
+  *         bytes of OUT_TEMP_L to OUT_Z_H_XL. To be used when the 9 bytes
+  *         transfer from OUT_TEMP_L is done outside of the driver
+  *         (e.g. by DMA).
   *
-  * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int1_drdy in reg INT1_CTRL
-  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  * @param  buff   Bytes read from OUT_TEMP_L.(ptr)
+  * @param  val    Temperature, STATUS and acceleration raw data.(ptr)
   *
   */
-int32_t lis3dhh_drdy_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
+void lis3dhh_snapshot_raw_decode(const uint8_t *buff,
+                                 lis3dhh_snapshot_t *val)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
-  int32_t ret;
-
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  lis3dhh_temperature_raw_decode(&buff[0], &val->temp);
+  *(uint8_t *)&val->status = buff[2];
+  lis3dhh_acceleration_raw_decode(&buff[3], val->xl);
+}
 
-  if (ret == 0)
-  {
-    int1_ctrl.int1_drdy = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
+/**
+  * @}
+  *
+  */
 
-  return ret;
-}
+/**
+  * @defgroup  LIS3DHH_common
+  * @brief     This section group common useful functions
+  * @{
+  *
+  */
 
 /**
-  * @brief  Data-ready signal on INT1 pin.[get]
+  * @brief  DeviceWhoamI.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int1_drdy in reg INT1_CTRL.(ptr)
+  * @param  buff   Buffer that stores data read
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_drdy_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_device_id_get(stmdev_ctx_t *ctx, uint8_t *buff)
 {
-  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  *val = int1_ctrl.int1_drdy;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_WHO_AM_I, buff, 1);
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark status on INT2 pin.[set]
+  * @brief  Software reset. Restore the default values in user registers.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_fth in reg INT2_CTRL
+  * @param  val    Change the values of sw_reset in reg CTRL_REG1.
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_threshold_on_int2_set(stmdev_ctx_t *ctx,
-                                           uint8_t val)
+int32_t lis3dhh_reset_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
   if (ret == 0)
   {
-    int2_ctrl.int2_fth = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ctrl_reg1.sw_reset = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark status on INT2 pin.[get]
+  * @brief  Software reset. Restore the default values in user registers.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int2_fth in reg INT2_CTRL.(ptr)
+  * @param  val    Get the values of sw_reset in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_threshold_on_int2_get(stmdev_ctx_t *ctx,
-                                           uint8_t *val)
+int32_t lis3dhh_reset_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  *val = int2_ctrl.int2_fth;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  *val = ctrl_reg1.sw_reset;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO full flag on INT2 pin.[set]
+  * @brief  Reboot memory content. Reload the calibration parameters.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_fss5 in reg INT2_CTRL
+  * @param  val    Change the values of boot in reg CTRL_REG1
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_full_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_boot_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
   if (ret == 0)
   {
-    int2_ctrl.int2_fss5 = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ctrl_reg1.boot = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO full flag on INT2 pin.[get]
+  * @brief  Reboot memory content. Reload the calibration parameters.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int2_fss5 in reg INT2_CTRL.(ptr)
+  * @param  val    Get the values of boot in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_full_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_boot_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  *val = int2_ctrl.int2_fss5;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  *val = ctrl_reg1.boot;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO overrun interrupt on INT2 pin.[set]
+  * @brief  Selftest.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_ovr in reg INT2_CTRL
+  * @param  val    Change the values of st in reg CTRL_REG4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_ovr_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_self_test_set(stmdev_ctx_t *ctx, lis3dhh_st_t val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
 
   if (ret == 0)
   {
-    int2_ctrl.int2_ovr = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ctrl_reg4.st = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO overrun interrupt on INT2 pin.[get]
+  * @brief  Selftest.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int2_ovr in reg INT2_CTRL.(ptr)
+  * @param  val    Get the values of st in reg CTRL_REG4.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_ovr_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_self_test_get(stmdev_ctx_t *ctx, lis3dhh_st_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  *val = int2_ctrl.int2_ovr;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+
+  switch (ctrl_reg4.st)
+  {
+    case LIS3DHH_ST_DISABLE:
+      *val = LIS3DHH_ST_DISABLE;
+      break;
+
+    case LIS3DHH_ST_POSITIVE:
+      *val = LIS3DHH_ST_POSITIVE;
+      break;
+
+    case LIS3DHH_ST_NEGATIVE:
+      *val = LIS3DHH_ST_NEGATIVE;
+      break;
+
+    default:
+      *val = LIS3DHH_ST_DISABLE;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  BOOT status on INT2 pin.[set]
+  * @brief  Digital filtering Phase/bandwidth selection.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_boot in reg INT2_CTRL
+  * @param  val    Change the values of dsp in reg CTRL_REG4
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_boot_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_filter_config_set(stmdev_ctx_t *ctx,
+                                  lis3dhh_dsp_t val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
 
   if (ret == 0)
   {
-    int2_ctrl.int2_boot = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ctrl_reg4.dsp = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  BOOT status on INT2 pin.[get]
+  * @brief  Digital filtering Phase/bandwidth selection.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int2_boot in reg INT2_CTRL.(ptr)
+  * @param  val    Get the values of dsp in reg CTRL_REG4.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_boot_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_filter_config_get(stmdev_ctx_t *ctx,
+                                  lis3dhh_dsp_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  *val = int2_ctrl.int2_boot;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
 
-  return ret;
+  switch (ctrl_reg4.dsp)
+  {
+    case LIS3DHH_LINEAR_PHASE_440Hz:
+      *val = LIS3DHH_LINEAR_PHASE_440Hz;
+      break;
+
+    case LIS3DHH_LINEAR_PHASE_235Hz:
+      *val = LIS3DHH_LINEAR_PHASE_235Hz;
+      break;
+
+    case LIS3DHH_NO_LINEAR_PHASE_440Hz:
+      *val = LIS3DHH_NO_LINEAR_PHASE_440Hz;
+      break;
+
+    case LIS3DHH_NO_LINEAR_PHASE_235Hz:
+      *val = LIS3DHH_NO_LINEAR_PHASE_235Hz;
+      break;
+
+    default:
+      *val = LIS3DHH_LINEAR_PHASE_440Hz;
+      break;
+  }
+
+  return ret;
 }
 
 /**
-  * @brief  Data-ready signal on INT2 pin.[set]
+  * @brief  Statusregister.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of int2_drdy in reg INT2_CTRL
+  * @param  val    Get registers STATUS.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_drdy_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_status_get(stmdev_ctx_t *ctx, lis3dhh_status_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_STATUS, (uint8_t *) val, 1);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_interrupts
+  * @brief     This section group all the functions that manage interrupts
+  * @{
+  *
+  */
+
+/**
+  * @brief  DRDY latched / pulsed, pulse duration is 1/4 ODR.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of drdy_pulse in reg CTRL_REG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_drdy_notification_mode_set(stmdev_ctx_t *ctx,
+                                           lis3dhh_drdy_pulse_t val)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
 
   if (ret == 0)
   {
-    int2_ctrl.int2_drdy = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ctrl_reg1.drdy_pulse = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Data-ready signal on INT2 pin.[get]
+  * @brief   DRDY latched / pulsed, pulse duration is 1/4 ODR.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of int2_drdy in reg INT2_CTRL.(ptr)
+  * @param  val    Get the values of drdy_pulse in reg CTRL_REG1.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_drdy_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_drdy_notification_mode_get(stmdev_ctx_t *ctx,
+                                           lis3dhh_drdy_pulse_t *val)
 {
-  lis3dhh_int2_ctrl_t int2_ctrl;
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  *val = int2_ctrl.int2_drdy;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+
+  switch (ctrl_reg1.drdy_pulse)
+  {
+    case LIS3DHH_LATCHED:
+      *val = LIS3DHH_LATCHED;
+      break;
+
+    case LIS3DHH_PULSED:
+      *val = LIS3DHH_PULSED;
+      break;
+
+    default:
+      *val = LIS3DHH_LATCHED;
+      break;
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Push-pull/open drain selection on interrupt pads.[set]
+  * @brief  It configures the INT1 pad as output for FIFO flags or as
+  *                external asynchronous input trigger to FIFO.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of pp_od in reg CTRL_REG4
+  * @param  val    Change the values of int1_ext in reg INT1_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_pin_mode_set(stmdev_ctx_t *ctx, lis3dhh_pp_od_t val)
+int32_t lis3dhh_int1_mode_set(stmdev_ctx_t *ctx,
+                              lis3dhh_int1_ext_t val)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
   if (ret == 0)
   {
-    ctrl_reg4.pp_od = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+    int1_ctrl.int1_ext = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Push-pull/open drain selection on interrupt pads.[get]
+  * @brief  It configures the INT1 pad as output for FIFO flags or as
+  *                external asynchronous input trigger to FIFO.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of pp_od in reg CTRL_REG4.(ptr)
+  * @param  val    Get the values of int1_ext in reg INT1_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_pin_mode_get(stmdev_ctx_t *ctx, lis3dhh_pp_od_t *val)
+int32_t lis3dhh_int1_mode_get(stmdev_ctx_t *ctx,
+                              lis3dhh_int1_ext_t *val)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
-  switch (ctrl_reg4.pp_od)
+  switch (int1_ctrl.int1_ext)
   {
-    case LIS3DHH_ALL_PUSH_PULL:
-      *val = LIS3DHH_ALL_PUSH_PULL;
-      break;
-
-    case LIS3DHH_INT1_OD_INT2_PP:
-      *val = LIS3DHH_INT1_OD_INT2_PP;
-      break;
-
-    case LIS3DHH_INT1_PP_INT2_OD:
-      *val = LIS3DHH_INT1_PP_INT2_OD;
+    case LIS3DHH_PIN_AS_INTERRUPT:
+      *val = LIS3DHH_PIN_AS_INTERRUPT;
       break;
 
-    case LIS3DHH_ALL_OPEN_DRAIN:
-      *val = LIS3DHH_ALL_OPEN_DRAIN;
+    case LIS3DHH_PIN_AS_TRIGGER:
+      *val = LIS3DHH_PIN_AS_TRIGGER;
       break;
 
     default:
-      *val = LIS3DHH_ALL_PUSH_PULL;
+      *val = LIS3DHH_PIN_AS_INTERRUPT;
       break;
   }
 
@@ -1189,355 +1615,3366 @@ int32_t lis3dhh_pin_mode_get(stmdev_ctx_t *ctx, lis3dhh_pp_od_t *val)
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  LIS3DHH_fifo
-  * @brief     This section group all the functions concerning the
-  *            fifo usage
-  * @{
-  *
-  */
-
-/**
-  * @brief  FIFOenable.[set]
+  * @brief  FIFO watermark status on INT1 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_en in reg CTRL_REG4
+  * @param  val    Change the values of int1_fth in reg INT1_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_fifo_threshold_on_int1_set(stmdev_ctx_t *ctx,
+                                           uint8_t val)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
   if (ret == 0)
   {
-    ctrl_reg4.fifo_en = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+    int1_ctrl.int1_fth = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFOenable.[get]
+  * @brief  FIFO watermark status on INT1 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fifo_en in reg CTRL_REG4.(ptr)
+  * @param  val    Get the values of int1_fth in reg INT1_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_threshold_on_int1_get(stmdev_ctx_t *ctx,
+                                           uint8_t *val)
 {
-  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
-  *val = ctrl_reg4.fifo_en;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  *val = int1_ctrl.int1_fth;
 
   return ret;
 }
 
 /**
-  * @brief  Enables the SPI high speed configuration for the FIFO block that
-            is used to guarantee a minimum duration of the window in which
-            writing operation of RAM output is blocked. This bit is recommended
-            for SPI clock frequencies higher than 6 MHz.[set]
+  * @brief  FIFO full flag on INT1 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fifo_spi_hs_on in reg CTRL_REG5
+  * @param  val    Change the values of int1_fss5 in reg INT1_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_block_spi_hs_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_fifo_full_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_ctrl_reg5_t ctrl_reg5;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
   if (ret == 0)
   {
-    ctrl_reg5.fifo_spi_hs_on = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
+    int1_ctrl.int1_fss5 = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enables the SPI high speed configuration for the FIFO block that
-            is used to guarantee a minimum duration of the window in which
-            writing operation of RAM output is blocked. This bit is recommended
-            for SPI clock frequencies higher than 6 MHz.[get]
+  * @brief  FIFO full flag on INT1 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fifo_spi_hs_on in reg CTRL_REG5.(ptr)
+  * @param  val    Get the values of int1_fss5 in reg INT1_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_block_spi_hs_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_full_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_ctrl_reg5_t ctrl_reg5;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
-  *val = ctrl_reg5.fifo_spi_hs_on;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  *val = int1_ctrl.int1_fss5;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark level selection.[set]
+  * @brief  FIFO overrun interrupt on INT1 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fth in reg FIFO_CTRL
+  * @param  val    Change the values of int1_ovr in reg INT1_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_watermark_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_fifo_ovr_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl.fth = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+    int1_ctrl.int1_ovr = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark level selection.[get]
+  * @brief  FIFO overrun interrupt on INT1 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fth in reg FIFO_CTRL.(ptr)
+  * @param  val    Get the values of int1_ovr in reg INT1_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_watermark_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_ovr_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
-  *val = fifo_ctrl.fth;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  *val = int1_ctrl.int1_ovr;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO mode selection.[set]
+  * @brief  BOOT status on INT1 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of fmode in reg FIFO_CTRL
+  * @param  val    Change the values of int1_boot in reg INT1_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_mode_set(stmdev_ctx_t *ctx, lis3dhh_fmode_t val)
+int32_t lis3dhh_boot_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
   if (ret == 0)
   {
-    fifo_ctrl.fmode = (uint8_t)val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+    int1_ctrl.int1_boot = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO mode selection.[get]
+  * @brief  BOOT status on INT1 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fmode in reg FIFO_CTRL.(ptr)
+  * @param  val    Get the values of int1_boot in reg INT1_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_mode_get(stmdev_ctx_t *ctx, lis3dhh_fmode_t *val)
+int32_t lis3dhh_boot_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  lis3dhh_int1_ctrl_t int1_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
-
-  switch (fifo_ctrl.fmode)
-  {
-    case LIS3DHH_BYPASS_MODE:
-      *val = LIS3DHH_BYPASS_MODE;
-      break;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  *val = int1_ctrl.int1_boot;
 
-    case LIS3DHH_FIFO_MODE:
-      *val = LIS3DHH_FIFO_MODE;
-      break;
+  return ret;
+}
 
-    case LIS3DHH_STREAM_TO_FIFO_MODE:
-      *val = LIS3DHH_STREAM_TO_FIFO_MODE;
-      break;
+/**
+  * @brief  Data-ready signal on INT1 pin.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int1_drdy in reg INT1_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_drdy_on_int1_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_int1_ctrl_t int1_ctrl;
+  int32_t ret;
 
-    case LIS3DHH_BYPASS_TO_STREAM_MODE:
-      *val = LIS3DHH_BYPASS_TO_STREAM_MODE;
-      break;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
 
-    case LIS3DHH_DYNAMIC_STREAM_MODE:
-      *val = LIS3DHH_DYNAMIC_STREAM_MODE;
-      break;
+  if (ret == 0)
+  {
+    int1_ctrl.int1_drdy = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  }
 
-    default:
-      *val = LIS3DHH_BYPASS_MODE;
-      break;
+  return ret;
+}
+
+/**
+  * @brief  Data-ready signal on INT1 pin.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of int1_drdy in reg INT1_CTRL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_drdy_on_int1_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_int1_ctrl_t int1_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+  *val = int1_ctrl.int1_drdy;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark status on INT2 pin.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int2_fth in reg INT2_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_threshold_on_int2_set(stmdev_ctx_t *ctx,
+                                           uint8_t val)
+{
+  lis3dhh_int2_ctrl_t int2_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+
+  if (ret == 0)
+  {
+    int2_ctrl.int2_fth = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO status register.[get]
+  * @brief  FIFO watermark status on INT2 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get registers FIFO_SRC.(ptr)
+  * @param  val    Get the values of int2_fth in reg INT2_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_status_get(stmdev_ctx_t *ctx,
-                                lis3dhh_fifo_src_t *val)
+int32_t lis3dhh_fifo_threshold_on_int2_get(stmdev_ctx_t *ctx,
+                                           uint8_t *val)
 {
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *) val, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  *val = int2_ctrl.int2_fth;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO stored data level.[get]
+  * @brief  FIFO full flag on INT2 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fss in reg FIFO_SRC.(ptr)
+  * @param  val    Change the values of int2_fss5 in reg INT2_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_full_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_full_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_fifo_src_t fifo_src;
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
-  *val = fifo_src.fss;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+
+  if (ret == 0)
+  {
+    int2_ctrl.int2_fss5 = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO overrun status flag.[get]
+  * @brief  FIFO full flag on INT2 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of ovrn in reg FIFO_SRC.(ptr)
+  * @param  val    Get the values of int2_fss5 in reg INT2_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_ovr_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_full_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_fifo_src_t fifo_src;
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
-  *val = fifo_src.ovrn;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  *val = int2_ctrl.int2_fss5;
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark status.[get]
+  * @brief  FIFO overrun interrupt on INT2 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of fth in reg FIFO_SRC.(ptr)
+  * @param  val    Change the values of int2_ovr in reg INT2_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_fifo_fth_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_fifo_ovr_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_fifo_src_t fifo_src;
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
-  *val = fifo_src.fth;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+
+  if (ret == 0)
+  {
+    int2_ctrl.int2_ovr = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  }
 
   return ret;
 }
 
 /**
-  * @}
+  * @brief  FIFO overrun interrupt on INT2 pin.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of int2_ovr in reg INT2_CTRL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_ovr_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_int2_ctrl_t int2_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  *val = int2_ctrl.int2_ovr;
+
+  return ret;
+}
+
+/**
+  * @brief  BOOT status on INT2 pin.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of int2_boot in reg INT2_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t lis3dhh_boot_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_int2_ctrl_t int2_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+
+  if (ret == 0)
+  {
+    int2_ctrl.int2_boot = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  }
+
+  return ret;
+}
 
 /**
-  * @defgroup  LIS3DHH_serial_interface
-  * @brief     This section group all the functions concerning serial
-  *            interface management
-  * @{
+  * @brief  BOOT status on INT2 pin.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of int2_boot in reg INT2_CTRL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
+int32_t lis3dhh_boot_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_int2_ctrl_t int2_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  *val = int2_ctrl.int2_boot;
+
+  return ret;
+}
 
 /**
-  * @brief  Register address automatically incremented during a multiple byte
-  *         access with a serial interface (I2C or SPI).[set]
+  * @brief  Data-ready signal on INT2 pin.[set]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Change the values of if_add_inc in reg CTRL_REG1
+  * @param  val    Change the values of int2_drdy in reg INT2_CTRL
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_auto_add_inc_set(stmdev_ctx_t *ctx, uint8_t val)
+int32_t lis3dhh_drdy_on_int2_set(stmdev_ctx_t *ctx, uint8_t val)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
 
   if (ret == 0)
   {
-    ctrl_reg1.if_add_inc = val;
-    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+    int2_ctrl.int2_drdy = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Register address automatically incremented during a multiple byte
-  *         access with a serial interface (I2C or SPI).[get]
+  * @brief  Data-ready signal on INT2 pin.[get]
   *
   * @param  ctx    Read / write interface definitions.(ptr)
-  * @param  val    Get the values of if_add_inc in reg CTRL_REG1.(ptr)
+  * @param  val    Get the values of int2_drdy in reg INT2_CTRL.(ptr)
   * @retval        Interface status (MANDATORY: return 0 -> no Error).
   *
   */
-int32_t lis3dhh_auto_add_inc_get(stmdev_ctx_t *ctx, uint8_t *val)
+int32_t lis3dhh_drdy_on_int2_get(stmdev_ctx_t *ctx, uint8_t *val)
 {
-  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  lis3dhh_int2_ctrl_t int2_ctrl;
   int32_t ret;
 
-  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
-  *val = ctrl_reg1.if_add_inc;
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  *val = int2_ctrl.int2_drdy;
+
+  return ret;
+}
+
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of pp_od in reg CTRL_REG4
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_pin_mode_set(stmdev_ctx_t *ctx, lis3dhh_pp_od_t val)
+{
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.pp_od = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  }
 
   return ret;
 }
 
+/**
+  * @brief  Push-pull/open drain selection on interrupt pads.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of pp_od in reg CTRL_REG4.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_pin_mode_get(stmdev_ctx_t *ctx, lis3dhh_pp_od_t *val)
+{
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+
+  switch (ctrl_reg4.pp_od)
+  {
+    case LIS3DHH_ALL_PUSH_PULL:
+      *val = LIS3DHH_ALL_PUSH_PULL;
+      break;
+
+    case LIS3DHH_INT1_OD_INT2_PP:
+      *val = LIS3DHH_INT1_OD_INT2_PP;
+      break;
+
+    case LIS3DHH_INT1_PP_INT2_OD:
+      *val = LIS3DHH_INT1_PP_INT2_OD;
+      break;
+
+    case LIS3DHH_ALL_OPEN_DRAIN:
+      *val = LIS3DHH_ALL_OPEN_DRAIN;
+      break;
+
+    default:
+      *val = LIS3DHH_ALL_PUSH_PULL;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_fifo
+  * @brief     This section group all the functions concerning the
+  *            fifo usage
+  * @{
+  *
+  */
+
+/**
+  * @brief  FIFOenable.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fifo_en in reg CTRL_REG4
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg4.fifo_en = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFOenable.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fifo_en in reg CTRL_REG4.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_ctrl_reg4_t ctrl_reg4;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG4, (uint8_t *)&ctrl_reg4, 1);
+  *val = ctrl_reg4.fifo_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Enables the SPI high speed configuration for the FIFO block that
+            is used to guarantee a minimum duration of the window in which
+            writing operation of RAM output is blocked. This bit is recommended
+            for SPI clock frequencies higher than 6 MHz.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fifo_spi_hs_on in reg CTRL_REG5
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_block_spi_hs_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg5.fifo_spi_hs_on = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables the SPI high speed configuration for the FIFO block that
+            is used to guarantee a minimum duration of the window in which
+            writing operation of RAM output is blocked. This bit is recommended
+            for SPI clock frequencies higher than 6 MHz.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fifo_spi_hs_on in reg CTRL_REG5.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_block_spi_hs_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_ctrl_reg5_t ctrl_reg5;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG5, (uint8_t *)&ctrl_reg5, 1);
+  *val = ctrl_reg5.fifo_spi_hs_on;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark level selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fth in reg FIFO_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_watermark_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl.fth = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark level selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fth in reg FIFO_CTRL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_watermark_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+  *val = fifo_ctrl.fth;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of fmode in reg FIFO_CTRL
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_mode_set(stmdev_ctx_t *ctx, lis3dhh_fmode_t val)
+{
+  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+
+  if (ret == 0)
+  {
+    fifo_ctrl.fmode = (uint8_t)val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fmode in reg FIFO_CTRL.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_mode_get(stmdev_ctx_t *ctx, lis3dhh_fmode_t *val)
+{
+  lis3dhh_fifo_ctrl_t fifo_ctrl;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_FIFO_CTRL, (uint8_t *)&fifo_ctrl, 1);
+
+  switch (fifo_ctrl.fmode)
+  {
+    case LIS3DHH_BYPASS_MODE:
+      *val = LIS3DHH_BYPASS_MODE;
+      break;
+
+    case LIS3DHH_FIFO_MODE:
+      *val = LIS3DHH_FIFO_MODE;
+      break;
+
+    case LIS3DHH_STREAM_TO_FIFO_MODE:
+      *val = LIS3DHH_STREAM_TO_FIFO_MODE;
+      break;
+
+    case LIS3DHH_BYPASS_TO_STREAM_MODE:
+      *val = LIS3DHH_BYPASS_TO_STREAM_MODE;
+      break;
+
+    case LIS3DHH_DYNAMIC_STREAM_MODE:
+      *val = LIS3DHH_DYNAMIC_STREAM_MODE;
+      break;
+
+    default:
+      *val = LIS3DHH_BYPASS_MODE;
+      break;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO status register.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get registers FIFO_SRC.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_status_get(stmdev_ctx_t *ctx,
+                                lis3dhh_fifo_src_t *val)
+{
+  int32_t ret;
+
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *) val, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO stored data level.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fss in reg FIFO_SRC.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_full_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_fifo_src_t fifo_src;
+  int32_t ret;
+
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
+  *val = fifo_src.fss;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO overrun status flag.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of ovrn in reg FIFO_SRC.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_ovr_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_fifo_src_t fifo_src;
+  int32_t ret;
+
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
+  *val = fifo_src.ovrn;
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark status.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of fth in reg FIFO_SRC.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_fth_flag_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_fifo_src_t fifo_src;
+  int32_t ret;
+
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)&fifo_src, 1);
+  *val = fifo_src.fth;
+
+  return ret;
+}
+
+/**
+  * @brief  Read the samples stored in FIFO in a single burst after
+  *         reading FIFO_SRC.[get]
+  *         The number of samples is taken from FIFO_SRC (fss) and the
+  *         output registers are read in one burst, relying on the
+  *         OUT_Z_H_XL -> OUT_X_L_XL wrap-around of the address
+  *         auto-increment (if_add_inc in reg CTRL_REG1 MUST be set).
+  *
+  * @param  ctx          Read / write interface definitions.(ptr)
+  * @param  xyz          Buffer of 3 * max_samples values that stores the
+  *                      samples read, X, Y, Z interleaved.(ptr)
+  * @param  max_samples  Maximum number of samples to read.
+  * @param  read         Number of samples read.(ptr)
+  * @retval              Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_data_get(stmdev_ctx_t *ctx, int16_t *xyz,
+                              uint16_t max_samples, uint16_t *read)
+{
+  lis3dhh_fifo_src_t fifo_src;
+  int32_t ret;
+
+  ret = lis3dhh_fifo_data_status_get(ctx, xyz, max_samples, read,
+                                     &fifo_src);
+
+  return ret;
+}
+
+/**
+  * @brief  Read the samples stored in FIFO in a single burst after
+  *         reading FIFO_SRC and report the FIFO_SRC content.[get]
+  *         See lis3dhh_fifo_data_get; FIFO_SRC is the same single byte
+  *         read used to size the burst, so no transaction is added.
+  *
+  * @param  ctx          Read / write interface definitions.(ptr)
+  * @param  xyz          Buffer of 3 * max_samples values that stores the
+  *                      samples read, X, Y, Z interleaved.(ptr)
+  * @param  max_samples  Maximum number of samples to read.
+  * @param  read         Number of samples read.(ptr)
+  * @param  status       FIFO_SRC before the samples are read.(ptr)
+  * @retval              Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_data_status_get(stmdev_ctx_t *ctx, int16_t *xyz,
+                                     uint16_t max_samples, uint16_t *read,
+                                     lis3dhh_fifo_src_t *status)
+{
+  uint8_t *buff = (uint8_t *)xyz;
+  uint16_t num;
+  int32_t ret;
+
+  *read = 0U;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)status, 1);
+
+  if (ret == 0)
+  {
+    num = (uint16_t)status->fss;
+
+    if (num > LIS3DHH_FIFO_DEPTH)
+    {
+      num = LIS3DHH_FIFO_DEPTH;
+    }
+
+    if (num > max_samples)
+    {
+      num = max_samples;
+    }
+
+    if (num > 0U)
+    {
+      ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_X_L_XL, buff, num * 6U);
+    }
+
+    if ((ret == 0) && (num > 0U))
+    {
+      lis3dhh_fifo_data_decode(buff, xyz, num);
+      *read = num;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO samples from the bytes read in burst from OUT_X_L_XL.
+  *         To be used when the num * 6 bytes transfer is done outside of
+  *         the driver (e.g. by DMA, after reading fss in FIFO_SRC).
+  *         buff and xyz may be the same buffer: each value is decoded in
+  *         place of its own bytes.
+  *
+  * @param  buff   Bytes read from OUT_X_L_XL.(ptr)
+  * @param  xyz    Samples, X, Y, Z interleaved.(ptr)
+  * @param  num    Number of samples.
+  *
+  */
+void lis3dhh_fifo_data_decode(const uint8_t *buff, int16_t *xyz,
+                              uint16_t num)
+{
+  lis3dhh_raw_decode(buff, xyz, (size_t)num * 3U);
+}
+
+/**
+  * @brief  Set up the state of the FIFO non-blocking read.
+  *
+  * @param  fa      Transfer state.(ptr)
+  * @param  submit  Starts a read of len bytes from reg into data, with
+  *                 the read_reg signature, and returns without waiting
+  *                 for its end (e.g. DMA).
+  *
+  */
+void lis3dhh_fifo_async_init(lis3dhh_fifo_async_t *fa,
+                             stmdev_read_ptr submit)
+{
+  fa->submit = submit;
+  fa->xyz = NULL;
+  fa->max_samples = 0U;
+  fa->read = 0U;
+  fa->status.fss = 0U;
+  fa->status.ovrn = 0U;
+  fa->status.fth = 0U;
+  fa->state = 0U;
+}
+
+/**
+  * @brief  Start a non-blocking read of the samples stored in FIFO.
+  *         Same sequence as lis3dhh_fifo_data_status_get (FIFO_SRC, then
+  *         fss * 6 bytes in a single burst from OUT_X_L_XL) split in two
+  *         transfers started with fa->submit, e.g. a DMA read. The end of
+  *         each transfer MUST be reported with lis3dhh_fifo_async_complete
+  *         (e.g. from the DMA interrupt). fa->submit has the read_reg
+  *         signature and receives ctx->handle; these transfers do not go
+  *         through lis3dhh_read_reg, so they are not traced.
+  *
+  * @param  ctx          Read / write interface definitions.(ptr)
+  * @param  fa           Transfer state, set up with
+  *                      lis3dhh_fifo_async_init.(ptr)
+  * @param  xyz          Buffer of 3 * max_samples values that stores the
+  *                      samples read, X, Y, Z interleaved; it is also
+  *                      the transfer buffer, so it MUST stay valid until
+  *                      the read is complete.(ptr)
+  * @param  max_samples  Maximum number of samples to read.
+  * @retval              0 -> transfer started, -1 -> a read is already
+  *                      in progress, otherwise the error returned by
+  *                      fa->submit.
+  *
+  */
+int32_t lis3dhh_fifo_async_start(stmdev_ctx_t *ctx, lis3dhh_fifo_async_t *fa,
+                                 int16_t *xyz, uint16_t max_samples)
+{
+  int32_t ret;
+
+  if (fa->state != 0U)
+  {
+    return -1;
+  }
+
+  fa->xyz = xyz;
+  fa->max_samples = max_samples;
+  fa->read = 0U;
+  fa->state = 1U;
+  ret = fa->submit(ctx->handle, LIS3DHH_FIFO_SRC, (uint8_t *)&fa->status, 1);
+
+  if (ret != 0)
+  {
+    fa->state = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Report the end of a transfer started by the FIFO non-blocking
+  *         read and continue it.
+  *         After FIFO_SRC the samples transfer is started, if any; after
+  *         the samples they are decoded in place in xyz.
+  *
+  * @param  ctx     Read / write interface definitions.(ptr)
+  * @param  fa      Transfer state.(ptr)
+  * @param  ret     Status of the completed transfer (0 -> no Error).
+  * @param  done    1 when the read is complete (fa->read samples and
+  *                 fa->status are valid), 0 if a further transfer has
+  *                 been started.(ptr)
+  * @retval         0 -> no Error, -1 -> no read in progress, otherwise the
+  *                 transfer error (the read is then aborted).
+  *
+  */
+int32_t lis3dhh_fifo_async_complete(stmdev_ctx_t *ctx,
+                                    lis3dhh_fifo_async_t *fa, int32_t ret,
+                                    uint8_t *done)
+{
+  uint16_t num;
+
+  *done = 0U;
+
+  if (fa->state == 0U)
+  {
+    return -1;
+  }
+
+  if (ret != 0)
+  {
+    fa->state = 0U;
+
+    return ret;
+  }
+
+  if (fa->state == 1U)
+  {
+    num = (uint16_t)fa->status.fss;
+
+    if (num > LIS3DHH_FIFO_DEPTH)
+    {
+      num = LIS3DHH_FIFO_DEPTH;
+    }
+
+    if (num > fa->max_samples)
+    {
+      num = fa->max_samples;
+    }
+
+    if (num > 0U)
+    {
+      fa->read = num;
+      fa->state = 2U;
+      ret = fa->submit(ctx->handle, LIS3DHH_OUT_X_L_XL, (uint8_t *)fa->xyz,
+                       num * 6U);
+
+      if (ret != 0)
+      {
+        fa->read = 0U;
+        fa->state = 0U;
+      }
+
+      return ret;
+    }
+  }
+
+  else
+  {
+    lis3dhh_fifo_data_decode((uint8_t *)fa->xyz, fa->xyz, fa->read);
+  }
+
+  fa->state = 0U;
+  *done = 1U;
+
+  return 0;
+}
+
+/**
+  * @brief  Read the samples stored in FIFO in a structure of arrays.[get]
+  *         Same transactions as lis3dhh_fifo_data_status_get (FIFO_SRC,
+  *         then a single burst), but X, Y and Z are stored in separate
+  *         arrays, while decoding the bytes, so that the following
+  *         processing can work on each axis without deinterleaving.
+  *
+  * @param  ctx      Read / write interface definitions.(ptr)
+  * @param  blk      Samples read, blk->num is the number of samples.(ptr)
+  * @param  status   FIFO_SRC read before the samples.(ptr)
+  * @retval          Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_fifo_block_get(stmdev_ctx_t *ctx, lis3dhh_block_t *blk,
+                               lis3dhh_fifo_src_t *status)
+{
+  uint8_t buff[LIS3DHH_FIFO_DEPTH * 6U];
+  uint16_t num;
+  int32_t ret;
+
+  blk->num = 0U;
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_SRC, (uint8_t *)status, 1);
+
+  if (ret == 0)
+  {
+    num = (uint16_t)status->fss;
+
+    if (num > LIS3DHH_FIFO_DEPTH)
+    {
+      num = LIS3DHH_FIFO_DEPTH;
+    }
+
+    if (num > 0U)
+    {
+      ret = lis3dhh_read_reg(ctx, LIS3DHH_OUT_X_L_XL, buff, num * 6U);
+    }
+
+    if ((ret == 0) && (num > 0U))
+    {
+      lis3dhh_fifo_block_decode(buff, blk, num);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO samples, as structure of arrays, from the bytes read in
+  *         burst from OUT_X_L_XL (see lis3dhh_fifo_data_decode).
+  *         Bytes are decoded with lis3dhh_raw_decode, then the values are
+  *         scattered to the X, Y, Z arrays.
+  *
+  * @param  buff   Bytes read from OUT_X_L_XL.(ptr)
+  * @param  blk    Samples, blk->num is set to num.(ptr)
+  * @param  num    Number of samples, max LIS3DHH_FIFO_DEPTH.
+  *
+  */
+void lis3dhh_fifo_block_decode(const uint8_t *buff, lis3dhh_block_t *blk,
+                               uint16_t num)
+{
+  int16_t xyz[LIS3DHH_FIFO_DEPTH * 3U];
+
+  if (num > LIS3DHH_FIFO_DEPTH)
+  {
+    num = LIS3DHH_FIFO_DEPTH;
+  }
+
+  lis3dhh_raw_decode(buff, xyz, (size_t)num * 3U);
+  lis3dhh_block_xyz_set(blk, xyz, num);
+}
+
+/**
+  * @brief  Samples of a block, X, Y, Z interleaved.[get]
+  *
+  * @param  blk    Samples.(ptr)
+  * @param  xyz    Buffer of 3 * blk->num values.(ptr)
+  *
+  */
+void lis3dhh_block_xyz_get(const lis3dhh_block_t *blk, int16_t *xyz)
+{
+  uint16_t i;
+
+  for (i = 0U; i < blk->num; i++)
+  {
+    xyz[3U * i] = blk->x[i];
+    xyz[(3U * i) + 1U] = blk->y[i];
+    xyz[(3U * i) + 2U] = blk->z[i];
+  }
+}
+
+/**
+  * @brief  Samples of a block, X, Y, Z interleaved.[set]
+  *
+  * @param  blk    Samples.(ptr)
+  * @param  xyz    Samples, X, Y, Z interleaved.(ptr)
+  * @param  num    Number of samples, max LIS3DHH_FIFO_DEPTH.
+  *
+  */
+void lis3dhh_block_xyz_set(lis3dhh_block_t *blk, const int16_t *xyz,
+                           uint16_t num)
+{
+  uint16_t i;
+
+  if (num > LIS3DHH_FIFO_DEPTH)
+  {
+    num = LIS3DHH_FIFO_DEPTH;
+  }
+
+  for (i = 0U; i < num; i++)
+  {
+    blk->x[i] = xyz[3U * i];
+    blk->y[i] = xyz[(3U * i) + 1U];
+    blk->z[i] = xyz[(3U * i) + 2U];
+  }
+
+  blk->num = num;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_serial_interface
+  * @brief     This section group all the functions concerning serial
+  *            interface management
+  * @{
+  *
+  */
+
+/**
+  * @brief  Register address automatically incremented during a multiple byte
+  *         access with a serial interface (I2C or SPI).[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Change the values of if_add_inc in reg CTRL_REG1
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_auto_add_inc_set(stmdev_ctx_t *ctx, uint8_t val)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+
+  if (ret == 0)
+  {
+    ctrl_reg1.if_add_inc = val;
+    ret = lis3dhh_write_reg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Register address automatically incremented during a multiple byte
+  *         access with a serial interface (I2C or SPI).[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Get the values of if_add_inc in reg CTRL_REG1.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_auto_add_inc_get(stmdev_ctx_t *ctx, uint8_t *val)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, LIS3DHH_CTRL_REG1, (uint8_t *)&ctrl_reg1, 1);
+  *val = ctrl_reg1.if_add_inc;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_configuration
+  * @brief     This section group the functions that write / read the
+  *            whole device configuration with burst transactions
+  * @{
+  *
+  */
+
+/**
+  * @brief  Write a burst of configuration registers and keep the shadow
+  *         copy (if any) coherent.
+  *
+  * @param  ctx   read / write interface definitions(ptr)
+  * @param  reg   first register to write
+  * @param  data  data to write(ptr)
+  * @param  len   number of consecutive register to write
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+static int32_t lis3dhh_write_cfg(stmdev_ctx_t *ctx, uint8_t reg,
+                                 uint8_t *data, uint16_t len)
+{
+  int32_t ret;
+
+  ret = lis3dhh_write_reg(ctx, reg, data, len);
+
+#if defined(LIS3DHH_SHADOW_REG)
+
+  if ((ret == 0) && (len > 1U))
+  {
+    lis3dhh_shadow_store(ctx, reg, data, len);
+  }
+
+#endif /* LIS3DHH_SHADOW_REG */
+
+  return ret;
+}
+
+/**
+  * @brief  Register content of a configuration: CTRL_REG1 to CTRL_REG5
+  *         followed by FIFO_CTRL, with boot and sw_reset cleared.
+  *
+  * @param  val   device configuration(ptr)
+  * @param  buff  6 bytes buffer that stores the register content(ptr)
+  *
+  */
+static void lis3dhh_config_pack(const lis3dhh_config_t *val,
+                                uint8_t *buff)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+
+  ctrl_reg1 = val->ctrl_reg1;
+  ctrl_reg1.boot = PROPERTY_DISABLE;
+  ctrl_reg1.sw_reset = PROPERTY_DISABLE;
+
+  buff[0] = *(uint8_t *)&ctrl_reg1;
+  buff[1] = *(const uint8_t *)&val->int1_ctrl;
+  buff[2] = *(const uint8_t *)&val->int2_ctrl;
+  buff[3] = *(const uint8_t *)&val->ctrl_reg4;
+  buff[4] = *(const uint8_t *)&val->ctrl_reg5;
+  buff[5] = *(const uint8_t *)&val->fifo_ctrl;
+}
+
+/**
+  * @brief  Device configuration, CTRL_REG1 to CTRL_REG5 and FIFO_CTRL.[set]
+  *         CTRL_REG1 to CTRL_REG5 are written in a single burst and
+  *         FIFO_CTRL in a second transaction. If the new configuration
+  *         clears if_add_inc, CTRL_REG1 is written last on its own.
+  *         boot and sw_reset are never set by this function, use
+  *         lis3dhh_boot_set / lis3dhh_reset_set.
+  *         if_add_inc in reg CTRL_REG1 MUST be set in the device (default).
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Device configuration.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_config_set(stmdev_ctx_t *ctx, const lis3dhh_config_t *val)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  uint8_t buff[6];
+  int32_t ret;
+
+  lis3dhh_config_pack(val, buff);
+  ctrl_reg1 = val->ctrl_reg1;
+
+  if (ctrl_reg1.if_add_inc == PROPERTY_ENABLE)
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_CTRL_REG1, buff, 5);
+  }
+
+  else
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_INT1_CTRL, &buff[1], 4);
+  }
+
+  if (ret == 0)
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_FIFO_CTRL, &buff[5], 1);
+  }
+
+  if ((ret == 0) && (ctrl_reg1.if_add_inc == PROPERTY_DISABLE))
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_CTRL_REG1, buff, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Device configuration update, only the registers whose
+  *         content differs between from and to are written.[set]
+  *         Adjacent registers to be written are merged in a single
+  *         burst when address auto-increment is enabled in the device;
+  *         CTRL_REG1 is written on its own, first when the update sets
+  *         if_add_inc and last when it clears it.
+  *         boot and sw_reset are never set by this function.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  from   Configuration currently applied to the device.(ptr)
+  * @param  to     New device configuration.(ptr)
+  * @param  num    Number of write transactions issued.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_config_apply_delta(stmdev_ctx_t *ctx,
+                                   const lis3dhh_config_t *from,
+                                   const lis3dhh_config_t *to,
+                                   uint8_t *num)
+{
+  uint8_t old_cfg[6];
+  uint8_t new_cfg[6];
+  uint8_t reg1_last = PROPERTY_DISABLE;
+  uint8_t inc;
+  uint8_t start;
+  uint8_t i = 0U;
+  int32_t ret = 0;
+
+  lis3dhh_config_pack(from, old_cfg);
+  lis3dhh_config_pack(to, new_cfg);
+  inc = from->ctrl_reg1.if_add_inc;
+  *num = 0U;
+
+  if ((old_cfg[0] != new_cfg[0]) &&
+      (inc != to->ctrl_reg1.if_add_inc))
+  {
+    if (inc == PROPERTY_DISABLE)
+    {
+      ret = lis3dhh_write_cfg(ctx, LIS3DHH_CTRL_REG1, new_cfg, 1);
+      (*num)++;
+      inc = PROPERTY_ENABLE;
+    }
+
+    else
+    {
+      reg1_last = PROPERTY_ENABLE;
+    }
+
+    i = 1U;
+  }
+
+  while ((i < 5U) && (ret == 0))
+  {
+    if (old_cfg[i] == new_cfg[i])
+    {
+      i++;
+    }
+
+    else
+    {
+      start = i;
+      i++;
+
+      while ((inc == PROPERTY_ENABLE) && (i < 5U) &&
+             (old_cfg[i] != new_cfg[i]))
+      {
+        i++;
+      }
+
+      ret = lis3dhh_write_cfg(ctx, (uint8_t)(LIS3DHH_CTRL_REG1 + start),
+                              &new_cfg[start], (uint16_t)i - start);
+      (*num)++;
+    }
+  }
+
+  if ((ret == 0) && (old_cfg[5] != new_cfg[5]))
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_FIFO_CTRL, &new_cfg[5], 1);
+    (*num)++;
+  }
+
+  if ((ret == 0) && (reg1_last == PROPERTY_ENABLE))
+  {
+    ret = lis3dhh_write_cfg(ctx, LIS3DHH_CTRL_REG1, new_cfg, 1);
+    (*num)++;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Device configuration, CTRL_REG1 to CTRL_REG5 and FIFO_CTRL.[get]
+  *         CTRL_REG1 to CTRL_REG5 are read in a single burst and
+  *         FIFO_CTRL in a second transaction. If if_add_inc is found
+  *         cleared, INT1_CTRL to CTRL_REG5 are read one by one.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  val    Device configuration.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_config_get(stmdev_ctx_t *ctx, lis3dhh_config_t *val)
+{
+  uint8_t buff[5];
+  uint8_t i;
+  int32_t ret;
+
+  ret = lis3dhh_read_reg(ctx, LIS3DHH_CTRL_REG1, buff, 5);
+  *(uint8_t *)&val->ctrl_reg1 = buff[0];
+
+  if ((ret == 0) && (val->ctrl_reg1.if_add_inc == PROPERTY_DISABLE))
+  {
+    for (i = 1U; (i < 5U) && (ret == 0); i++)
+    {
+      ret = lis3dhh_read_reg(ctx, (uint8_t)(LIS3DHH_CTRL_REG1 + i),
+                             &buff[i], 1);
+    }
+  }
+
+#if defined(LIS3DHH_SHADOW_REG)
+
+  else if (ret == 0)
+  {
+    lis3dhh_shadow_store(ctx, LIS3DHH_CTRL_REG1, buff, 5);
+  }
+
+#endif /* LIS3DHH_SHADOW_REG */
+
+  else
+  {
+    /* burst read completed */
+  }
+
+  *(uint8_t *)&val->int1_ctrl = buff[1];
+  *(uint8_t *)&val->int2_ctrl = buff[2];
+  *(uint8_t *)&val->ctrl_reg4 = buff[3];
+  *(uint8_t *)&val->ctrl_reg5 = buff[4];
+
+  if (ret == 0)
+  {
+    ret = lis3dhh_read_reg(ctx, LIS3DHH_FIFO_CTRL,
+                           (uint8_t *)&val->fifo_ctrl, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Load a configuration made of address / data lines, e.g.
+  *         generated by Unico / Unicleo (see LIS3DHH_UCF_LINE).
+  *         Lines are written in order, with the following reductions:
+  *         - lines on consecutive addresses in CTRL_REG1..CTRL_REG5 are
+  *           merged in a single burst write while address
+  *           auto-increment is enabled;
+  *         - lines writing a value already written by a previous line of
+  *           the same load are dropped (unless merged in a burst).
+  *         CTRL_REG1 lines that set boot / sw_reset or that change
+  *         if_add_inc are written on their own.
+  *         if_add_inc in reg CTRL_REG1 MUST be set in the device (default).
+  *         No write is done if a line addresses a read-only register.
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  ucf    Configuration lines.(ptr)
+  * @param  len    Number of lines.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error),
+  *                -1 if a line addresses a read-only register.
+  *
+  */
+int32_t lis3dhh_ucf_load(stmdev_ctx_t *ctx, const ucf_line_t *ucf,
+                         uint16_t len)
+{
+  lis3dhh_ctrl_reg1_t ctrl_reg1;
+  uint8_t value[LIS3DHH_SHADOW_NUM];
+  uint8_t buff[5];
+  uint8_t known = 0U;
+  uint8_t inc = PROPERTY_ENABLE;
+  uint8_t alone;
+  uint8_t start = 0U;
+  uint8_t cnt = 0U;
+  uint8_t reg;
+  uint16_t i;
+  int32_t idx;
+  int32_t ret = 0;
+
+  for (i = 0U; (i < len) && (ret == 0); i++)
+  {
+    if (lis3dhh_cfg_index(ucf[i].address) < 0)
+    {
+      ret = -1;
+    }
+  }
+
+  for (i = 0U; (i < len) && (ret == 0); i++)
+  {
+    reg = ucf[i].address;
+    idx = lis3dhh_cfg_index(reg);
+    alone = PROPERTY_DISABLE;
+
+    if (reg == LIS3DHH_CTRL_REG1)
+    {
+      *(uint8_t *)&ctrl_reg1 = ucf[i].data;
+
+      if ((ctrl_reg1.boot != 0U) || (ctrl_reg1.sw_reset != 0U) ||
+          (ctrl_reg1.if_add_inc != inc))
+      {
+        alone = PROPERTY_ENABLE;
+      }
+    }
+
+    if ((alone == PROPERTY_DISABLE) && (cnt > 0U) &&
+        (inc == PROPERTY_ENABLE) && (reg == (start + cnt)) &&
+        (reg <= LIS3DHH_CTRL_REG5))
+    {
+      /* next register of the current burst */
+      buff[cnt] = ucf[i].data;
+      cnt++;
+    }
+
+    else if ((alone == PROPERTY_DISABLE) &&
+             ((known & (1U << (uint32_t)idx)) != 0U) &&
+             (value[idx] == ucf[i].data))
+    {
+      /* value already written */
+    }
+
+    else
+    {
+      if (cnt > 0U)
+      {
+        ret = lis3dhh_write_cfg(ctx, start, buff, cnt);
+      }
+
+      start = reg;
+      buff[0] = ucf[i].data;
+      cnt = 1U;
+    }
+
+    known |= (uint8_t)(1U << (uint32_t)idx);
+    value[idx] = ucf[i].data;
+
+    if ((ret == 0) && (alone == PROPERTY_ENABLE))
+    {
+      ret = lis3dhh_write_cfg(ctx, start, buff, cnt);
+      cnt = 0U;
+      inc = ctrl_reg1.if_add_inc;
+
+      if ((ctrl_reg1.boot != 0U) || (ctrl_reg1.sw_reset != 0U))
+      {
+        known = 0U;
+      }
+    }
+  }
+
+  if ((ret == 0) && (cnt > 0U))
+  {
+    ret = lis3dhh_write_cfg(ctx, start, buff, cnt);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Update several fields of a control register with a single
+  *         write, e.g. bdu and norm_mod_en in CTRL_REG1:
+  *         mask = LIS3DHH_CTRL_REG1_BDU_MSK | LIS3DHH_CTRL_REG1_NORM_MOD_EN_MSK
+  *         val  = (1U << LIS3DHH_CTRL_REG1_BDU_POS) |
+  *                (1U << LIS3DHH_CTRL_REG1_NORM_MOD_EN_POS).
+  *         Field position and mask macros are independent of the
+  *         compiler bit-field layout and of DRV_BYTE_ORDER.[set]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  reg    Control register (CTRL_REG1..CTRL_REG5, FIFO_CTRL).
+  * @param  mask   Bits to be updated.
+  * @param  val    New value of the bits selected by mask.
+  * @retval        Interface status (MANDATORY: return 0 -> no Error),
+  *                -1 if reg is not writable.
+  *
+  */
+int32_t lis3dhh_reg_fields_set(stmdev_ctx_t *ctx, uint8_t reg,
+                               uint8_t mask, uint8_t val)
+{
+  uint8_t data;
+  int32_t ret;
+
+  if (lis3dhh_cfg_index(reg) < 0)
+  {
+    ret = -1;
+  }
+
+  else
+  {
+    ret = lis3dhh_read_cfg(ctx, reg, &data, 1);
+
+    if (ret == 0)
+    {
+      data = (data & (uint8_t)~mask) | (val & mask);
+      ret = lis3dhh_write_reg(ctx, reg, &data, 1);
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Read several fields of a register, the bits not selected by
+  *         mask are returned cleared.[get]
+  *
+  * @param  ctx    Read / write interface definitions.(ptr)
+  * @param  reg    Register address.
+  * @param  mask   Bits to be read.
+  * @param  val    Register content masked.(ptr)
+  * @retval        Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_reg_fields_get(stmdev_ctx_t *ctx, uint8_t reg,
+                               uint8_t mask, uint8_t *val)
+{
+  uint8_t data;
+  int32_t ret;
+
+  ret = lis3dhh_read_cfg(ctx, reg, &data, 1);
+  *val = data & mask;
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_sample_ring
+  * @brief     This section group the functions of the lock free sample
+  *            queue between interrupt handler and application
+  * @{
+  *
+  */
+
+/**
+  * @brief  Initialize an empty sample queue.
+  *
+  * @param  ring   Sample queue.(ptr)
+  * @param  buff   Storage of the queue.(ptr)
+  * @param  size   Number of samples in buff, power of 2 (max 32768).
+  * @retval        0 -> no Error, -1 -> size not allowed.
+  *
+  */
+int32_t lis3dhh_ring_init(lis3dhh_ring_t *ring, lis3dhh_sample_t *buff,
+                          uint16_t size)
+{
+  int32_t ret;
+
+  if ((size == 0U) || ((size & (size - 1U)) != 0U))
+  {
+    ret = -1;
+  }
+
+  else
+  {
+    ring->buff = buff;
+    ring->mask = size - 1U;
+    ring->head = 0U;
+    ring->tail = 0U;
+    ring->ovr = 0U;
+    ret = 0;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Add a sample to the queue (producer side, e.g. DRDY or FTH
+  *         interrupt handler). Wait-free: if the queue is full the
+  *         sample is dropped and counted in ovr.
+  *
+  * @param  ring   Sample queue.(ptr)
+  * @param  val    Sample to add.(ptr)
+  * @retval        0 -> sample queued, -1 -> queue full.
+  *
+  */
+int32_t lis3dhh_ring_push(lis3dhh_ring_t *ring,
+                          const lis3dhh_sample_t *val)
+{
+  uint16_t head = ring->head;
+  int32_t ret;
+
+  if ((uint16_t)(head - ring->tail) > ring->mask)
+  {
+    ring->ovr++;
+    ret = -1;
+  }
+
+  else
+  {
+    ring->buff[head & ring->mask] = *val;
+    LIS3DHH_MEM_BARRIER();
+    ring->head = head + 1U;
+    ret = 0;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Remove up to max samples from the queue (consumer side).
+  *
+  * @param  ring   Sample queue.(ptr)
+  * @param  val    Buffer that stores the samples removed.(ptr)
+  * @param  max    Maximum number of samples to remove.
+  * @retval        Number of samples removed.
+  *
+  */
+uint16_t lis3dhh_ring_pop(lis3dhh_ring_t *ring, lis3dhh_sample_t *val,
+                          uint16_t max)
+{
+  uint16_t tail = ring->tail;
+  uint16_t num;
+  uint16_t i;
+
+  num = ring->head - tail;
+  LIS3DHH_MEM_BARRIER();
+
+  if (num > max)
+  {
+    num = max;
+  }
+
+  for (i = 0U; i < num; i++)
+  {
+    val[i] = ring->buff[(uint16_t)(tail + i) & ring->mask];
+  }
+
+  LIS3DHH_MEM_BARRIER();
+  ring->tail = tail + num;
+
+  return num;
+}
+
+/**
+  * @brief  Number of samples waiting in the queue.
+  *
+  * @param  ring   Sample queue.(ptr)
+  * @retval        Number of samples.
+  *
+  */
+uint16_t lis3dhh_ring_level_get(const lis3dhh_ring_t *ring)
+{
+  return (uint16_t)(ring->head - ring->tail);
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_fifo_scheduler
+  * @brief     This section group the functions that plan the FIFO drains
+  *            of several devices sharing the same bus
+  * @{
+  *
+  */
+
+/**
+  * @brief  Initialize the scheduling state of a device.
+  *
+  * @param  dev     Device scheduling state.(ptr)
+  * @param  ctx     Read / write interface definitions of the device.(ptr)
+  * @param  period  Sample period (1 / ODR) in the time unit used by the
+  *                 application (e.g. 909 for 1.1 kHz and 1 us ticks).
+  * @param  now     Current time, FIFO assumed empty.
+  * @retval         0 -> no Error, -1 -> period not allowed.
+  *
+  */
+int32_t lis3dhh_sched_init(lis3dhh_sched_dev_t *dev, stmdev_ctx_t *ctx,
+                           uint32_t period, uint32_t now)
+{
+  int32_t ret = 0;
+
+  if (period == 0U)
+  {
+    ret = -1;
+  }
+
+  else
+  {
+    dev->ctx = ctx;
+    dev->period = period;
+    dev->last = now;
+    dev->level = 0U;
+    dev->headroom = (uint8_t)LIS3DHH_FIFO_DEPTH;
+    dev->late_max = 0U;
+    dev->ovr = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Samples expected in the FIFO of a device at a given time,
+  *         computed from the last drain without bus access.
+  *
+  * @param  dev     Device scheduling state.(ptr)
+  * @param  now     Current time.
+  * @retval         Expected FIFO level, saturated to LIS3DHH_FIFO_DEPTH.
+  *
+  */
+uint8_t lis3dhh_sched_level_get(const lis3dhh_sched_dev_t *dev,
+                                uint32_t now)
+{
+  uint32_t level;
+
+  level = ((now - dev->last) / dev->period) + (uint32_t)dev->level;
+
+  if (level > LIS3DHH_FIFO_DEPTH)
+  {
+    level = LIS3DHH_FIFO_DEPTH;
+  }
+
+  return (uint8_t)level;
+}
+
+/**
+  * @brief  Select the device to be drained first: the one with the
+  *         earliest FIFO full deadline, i.e. the highest expected level
+  *         (ties resolved in favor of the lowest index).
+  *
+  * @param  dev     Array of device scheduling states.(ptr)
+  * @param  num     Number of devices (at least 1).
+  * @param  now     Current time.
+  * @retval         Index of the device to drain.
+  *
+  */
+uint8_t lis3dhh_sched_next(const lis3dhh_sched_dev_t *dev, uint8_t num,
+                           uint32_t now)
+{
+  uint8_t best = 0U;
+  uint8_t best_level = 0U;
+  uint8_t level;
+  uint8_t i;
+
+  for (i = 0U; i < num; i++)
+  {
+    level = lis3dhh_sched_level_get(&dev[i], now);
+
+    if ((i == 0U) || (level > best_level))
+    {
+      best = i;
+      best_level = level;
+    }
+  }
+
+  return best;
+}
+
+/**
+  * @brief  Drain the FIFO of a device and update its scheduling
+  *         statistics: minimum free FIFO levels found (headroom),
+  *         maximum delay after the FIFO full deadline (late_max) and
+  *         number of drains that found the FIFO overrun (ovr).
+  *
+  * @param  dev          Device scheduling state.(ptr)
+  * @param  now          Current time.
+  * @param  xyz          Buffer of 3 * max_samples values that stores the
+  *                      samples read, X, Y, Z interleaved.(ptr)
+  * @param  max_samples  Maximum number of samples to read.
+  * @param  read         Number of samples read.(ptr)
+  * @retval              Interface status (MANDATORY: return 0 -> no Error).
+  *
+  */
+int32_t lis3dhh_sched_drain(lis3dhh_sched_dev_t *dev, uint32_t now,
+                            int16_t *xyz, uint16_t max_samples,
+                            uint16_t *read)
+{
+  lis3dhh_fifo_src_t fifo_src;
+  uint32_t deadline;
+  uint32_t late;
+  uint8_t fss;
+  int32_t ret;
+
+  ret = lis3dhh_fifo_data_status_get(dev->ctx, xyz, max_samples, read,
+                                     &fifo_src);
+
+  if (ret == 0)
+  {
+    fss = fifo_src.fss;
+
+    if (fss > LIS3DHH_FIFO_DEPTH)
+    {
+      fss = (uint8_t)LIS3DHH_FIFO_DEPTH;
+    }
+
+    if ((LIS3DHH_FIFO_DEPTH - fss) < dev->headroom)
+    {
+      dev->headroom = (uint8_t)(LIS3DHH_FIFO_DEPTH - fss);
+    }
+
+    if (fifo_src.ovrn != 0U)
+    {
+      dev->ovr++;
+    }
+
+    deadline = dev->last +
+               ((LIS3DHH_FIFO_DEPTH - (uint32_t)dev->level) * dev->period);
+    late = now - deadline;
+
+    if (((int32_t)late > 0) && (late > dev->late_max))
+    {
+      dev->late_max = late;
+    }
+
+    dev->level = (uint8_t)(fss - *read);
+    dev->last = now;
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_fifo_timestamp
+  * @brief     This section group the functions that timestamp the
+  *            samples read from FIFO
+  * @{
+  *
+  */
+
+/**
+  * @brief  Initialize the FIFO timestamp estimator.
+  *
+  * @param  ts      Timestamp estimator.(ptr)
+  * @param  period  Nominal sample period (1 / ODR) in the time unit used
+  *                 by the application (e.g. 909 for 1.1 kHz and 1 us).
+  * @param  gain    Filter gain 2^-gain, from 0 (no filtering) to 8;
+  *                 higher values give smoother estimate, slower tracking.
+  * @retval         0 -> no Error, -1 -> parameter not allowed.
+  *
+  */
+int32_t lis3dhh_ts_init(lis3dhh_ts_t *ts, uint32_t period, uint8_t gain)
+{
+  int32_t ret = 0;
+
+  if ((period == 0U) || (period > 0xFFFFU) || (gain > 8U))
+  {
+    ret = -1;
+  }
+
+  else
+  {
+    ts->nominal = period << 16;
+    ts->period = period << 16;
+    ts->t_newest = 0U;
+    ts->newest = 0U;
+    ts->drained = 0U;
+    ts->gain = gain;
+    ts->valid = PROPERTY_DISABLE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Update the estimator with a FIFO read and compute the
+  *         timestamps of the samples read.
+  *         To be called after each lis3dhh_fifo_data_status_get with the
+  *         time FIFO_SRC was read (e.g. FTH / DRDY interrupt time when
+  *         the FIFO is drained in the interrupt handler). The newest
+  *         sample stored is assumed produced at that time, the older
+  *         ones one period apart. On FIFO overrun the sample count is
+  *         lost, so the filter restarts from t keeping the period.
+  *
+  * @param  ts      Timestamp estimator.(ptr)
+  * @param  t       Time FIFO_SRC was read.
+  * @param  status  FIFO_SRC content.(ptr)
+  * @param  read    Number of samples read from FIFO (oldest first).
+  * @param  stamps  Buffer of read values that stores the timestamps,
+  *                 may be NULL.(ptr)
+  *
+  */
+void lis3dhh_ts_update(lis3dhh_ts_t *ts, uint32_t t,
+                       const lis3dhh_fifo_src_t *status, uint16_t read,
+                       uint32_t *stamps)
+{
+  uint32_t newest;
+  uint32_t dn;
+  uint32_t pred;
+  int32_t res;
+  int64_t corr;
+  uint16_t k;
+
+  newest = ts->drained + (uint32_t)status->fss;
+  dn = newest - ts->newest;
+
+  if ((ts->valid == PROPERTY_DISABLE) || (status->ovrn != 0U))
+  {
+    ts->t_newest = t;
+    ts->valid = PROPERTY_ENABLE;
+  }
+
+  else if (dn > 0U)
+  {
+    pred = ts->t_newest +
+           (uint32_t)(((uint64_t)dn * (uint64_t)ts->period) >> 16);
+    res = (int32_t)(t - pred);
+    ts->t_newest = pred + (uint32_t)(res / (1L << ts->gain));
+    corr = ((int64_t)res * 65536) / (int64_t)dn;
+    corr = corr / (1L << (2U * ts->gain));
+    ts->period = (uint32_t)((int64_t)ts->period + corr);
+  }
+
+  else
+  {
+    /* no new sample since last update */
+  }
+
+  ts->newest = newest;
+
+  if (stamps != NULL)
+  {
+    for (k = 0U; k < read; k++)
+    {
+      stamps[k] = ts->t_newest -
+                  (uint32_t)(((uint64_t)(status->fss - 1U - k) *
+                              (uint64_t)ts->period) >> 16);
+    }
+  }
+
+  ts->drained += read;
+}
+
+/**
+  * @brief  Drift of the estimated sample period with respect to the
+  *         nominal one.
+  *
+  * @param  ts      Timestamp estimator.(ptr)
+  * @retval         Drift in ppm, positive if the device ODR is slower
+  *                 than nominal.
+  *
+  */
+int32_t lis3dhh_ts_drift_get(const lis3dhh_ts_t *ts)
+{
+  int64_t diff;
+
+  diff = (int64_t)ts->period - (int64_t)ts->nominal;
+
+  return (int32_t)((diff * 1000000) / (int64_t)ts->nominal);
+}
+
+/**
+  * @}
+  *
+  */
+
+#if defined(LIS3DHH_INCLINATION)
+
+/**
+  * @defgroup  LIS3DHH_inclination
+  * @brief     This section group the functions that compute tilt angles
+  *            from acceleration raw data
+  * @{
+  *
+  */
+
+/**
+  * @brief  Arc tangent of y / x in the range [-pi, pi] rad.
+  *         The polynomial approximations work on min / max of |x|, |y|
+  *         in [0, 1] and are extended to the four quadrants by symmetry.
+  *
+  * @param  y       Ordinate.
+  * @param  x       Abscissa.
+  * @param  mode    Approximation used.
+  * @retval         Angle in rad, 0 if x and y are 0.
+  *
+  */
+static float_t lis3dhh_atan2(float_t y, float_t x, lis3dhh_atan_t mode)
+{
+  float_t ax = fabsf(x);
+  float_t ay = fabsf(y);
+  float_t z;
+  float_t z2;
+  float_t a;
+
+  if (mode == LIS3DHH_ATAN_LIBM)
+  {
+    a = atan2f(y, x);
+  }
+
+  else if ((ax == 0.0f) && (ay == 0.0f))
+  {
+    a = 0.0f;
+  }
+
+  else
+  {
+    z = (ay > ax) ? (ax / ay) : (ay / ax);
+
+    if (mode == LIS3DHH_ATAN_FAST)
+    {
+      a = (0.7853982f * z) + (0.273f * z * (1.0f - z));
+    }
+
+    else
+    {
+      z2 = z * z;
+      a = z * (0.9998660f + (z2 * (-0.3302995f + (z2 * (0.1801410f +
+                                                      (z2 * (-0.0851330f + (z2 * 0.0208351f))))))));
+    }
+
+    if (ay > ax)
+    {
+      a = 1.5707963f - a;
+    }
+
+    if (x < 0.0f)
+    {
+      a = 3.1415927f - a;
+    }
+
+    if (y < 0.0f)
+    {
+      a = -a;
+    }
+  }
+
+  return a;
+}
+
+/**
+  * @brief  Tilt angles of an array of acceleration raw samples.
+  *         Angles only depend on ratios of the axes, so raw values are
+  *         used as they are, without conversion to mg.
+  *         pitch = atan2(X, sqrt(Y^2 + Z^2)), rotation about Y
+  *         roll  = atan2(Y, Z), rotation about X
+  *         tilt  = atan2(sqrt(X^2 + Y^2), Z), angle from vertical
+  *
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  n       Number of samples.
+  * @param  mode    Arc tangent approximation.
+  * @param  pitch   Buffer of n values that stores pitch in deg [-90, 90],
+  *                 NULL if not needed.(ptr)
+  * @param  roll    Buffer of n values that stores roll in deg [-180, 180],
+  *                 NULL if not needed.(ptr)
+  * @param  tilt    Buffer of n values that stores tilt in deg [0, 180],
+  *                 NULL if not needed.(ptr)
+  *
+  */
+void lis3dhh_tilt_array(const int16_t *xyz, size_t n, lis3dhh_atan_t mode,
+                        float_t *pitch, float_t *roll, float_t *tilt)
+{
+  float_t x;
+  float_t y;
+  float_t z;
+  size_t i;
+
+  for (i = 0U; i < n; i++)
+  {
+    x = (float_t)xyz[3U * i];
+    y = (float_t)xyz[(3U * i) + 1U];
+    z = (float_t)xyz[(3U * i) + 2U];
+
+    if (pitch != NULL)
+    {
+      pitch[i] = 57.29578f * lis3dhh_atan2(x, sqrtf((y * y) + (z * z)), mode);
+    }
+
+    if (roll != NULL)
+    {
+      roll[i] = 57.29578f * lis3dhh_atan2(y, z, mode);
+    }
+
+    if (tilt != NULL)
+    {
+      tilt[i] = 57.29578f * lis3dhh_atan2(sqrtf((x * x) + (y * y)), z, mode);
+    }
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+#endif /* LIS3DHH_INCLINATION */
+
+/**
+  * @defgroup  LIS3DHH_temperature_compensation
+  * @brief     This section group the functions that compensate offset and
+  *            sensitivity drift of acceleration versus temperature
+  * @{
+  *
+  */
+
+/**
+  * @brief  Compensation coefficients at a given temperature.
+  *         Compensated acceleration is (raw * 0.076 - off(T)) / (1 + gain(T))
+  *         and is rewritten as raw * a + b.
+  *
+  * @param  tc      Compensation polynomials.(ptr)
+  * @param  t_raw   Temperature raw value.
+  * @param  a       Scale of X, Y, Z in mg/LSB.(ptr)
+  * @param  b       Offset of X, Y, Z in mg.(ptr)
+  *
+  */
+static void lis3dhh_tcomp_coef(const lis3dhh_tcomp_t *tc, int16_t t_raw,
+                               float_t *a, float_t *b)
+{
+  float_t dt = lis3dhh_from_lsb_to_celsius(t_raw) - tc->t_ref;
+  float_t off;
+  float_t gain;
+  uint8_t i;
+  uint8_t k;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    off = 0.0f;
+    gain = 0.0f;
+
+    for (k = LIS3DHH_TCOMP_ORDER; k > 0U; k--)
+    {
+      off = (off * dt) + tc->off[i][k - 1U];
+      gain = (gain * dt) + tc->gain[i][k - 1U];
+    }
+
+    a[i] = 0.076f / (1.0f + gain);
+    b[i] = -off * a[i] / 0.076f;
+  }
+}
+
+/**
+  * @brief  Temperature compensation of a batch of acceleration raw samples.
+  *         Temperature is only needed at the first and the last sample of
+  *         the batch, e.g. read once per FIFO drain; the coefficients are
+  *         evaluated there and linearly interpolated in between, so the
+  *         per-sample cost is one multiply-add per axis as for
+  *         lis3dhh_from_lsb_to_mg_array.
+  *
+  * @param  tc      Compensation polynomials.(ptr)
+  * @param  t_first Temperature raw value at the first sample.
+  * @param  t_last  Temperature raw value at the last sample.
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  n       Number of samples.
+  * @param  mg      Buffer of 3 * n values that stores compensated
+  *                 acceleration in mg, may not overlap xyz.(ptr)
+  *
+  */
+void lis3dhh_tcomp_apply(const lis3dhh_tcomp_t *tc, int16_t t_first,
+                         int16_t t_last, const int16_t *xyz, size_t n,
+                         float_t *mg)
+{
+  float_t a0[3];
+  float_t b0[3];
+  float_t a1[3];
+  float_t b1[3];
+  float_t da[3] = { 0.0f, 0.0f, 0.0f };
+  float_t db[3] = { 0.0f, 0.0f, 0.0f };
+  float_t f;
+  size_t i;
+  uint8_t j;
+
+  if (n == 0U)
+  {
+    return;
+  }
+
+  lis3dhh_tcomp_coef(tc, t_first, a0, b0);
+
+  if ((n > 1U) && (t_last != t_first))
+  {
+    lis3dhh_tcomp_coef(tc, t_last, a1, b1);
+
+    for (j = 0U; j < 3U; j++)
+    {
+      da[j] = (a1[j] - a0[j]) / (float_t)(n - 1U);
+      db[j] = (b1[j] - b0[j]) / (float_t)(n - 1U);
+    }
+  }
+
+  for (i = 0U; i < n; i++)
+  {
+    f = (float_t)i;
+
+    for (j = 0U; j < 3U; j++)
+    {
+      mg[(3U * i) + j] = ((float_t)xyz[(3U * i) + j] * (a0[j] + (da[j] * f))) +
+                         (b0[j] + (db[j] * f));
+    }
+  }
+}
+
+/**
+  * @brief  Temperature compensation of a batch of acceleration raw samples
+  *         in micro-g (integer).
+  *         Same as lis3dhh_tcomp_apply; floating point is only used to
+  *         evaluate the coefficients at the batch ends, the per-sample
+  *         path is fixed point (scale in Q32 ug/LSB, offset in Q32 ug).
+  *
+  * @param  tc      Compensation polynomials.(ptr)
+  * @param  t_first Temperature raw value at the first sample.
+  * @param  t_last  Temperature raw value at the last sample.
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  n       Number of samples.
+  * @param  ug      Buffer of 3 * n values that stores compensated
+  *                 acceleration in ug.(ptr)
+  *
+  */
+void lis3dhh_tcomp_apply_ug(const lis3dhh_tcomp_t *tc, int16_t t_first,
+                            int16_t t_last, const int16_t *xyz, size_t n,
+                            int32_t *ug)
+{
+  float_t af[3];
+  float_t bf[3];
+  int64_t a[3];
+  int64_t b[3];
+  int64_t da[3] = { 0, 0, 0 };
+  int64_t db[3] = { 0, 0, 0 };
+  int64_t acc;
+  size_t i;
+  uint8_t j;
+
+  if (n == 0U)
+  {
+    return;
+  }
+
+  lis3dhh_tcomp_coef(tc, t_first, af, bf);
+
+  for (j = 0U; j < 3U; j++)
+  {
+    a[j] = (int64_t)(af[j] * 4294967296000.0f);
+    b[j] = (int64_t)(bf[j] * 4294967296000.0f);
+  }
+
+  if ((n > 1U) && (t_last != t_first))
+  {
+    lis3dhh_tcomp_coef(tc, t_last, af, bf);
+
+    for (j = 0U; j < 3U; j++)
+    {
+      da[j] = ((int64_t)(af[j] * 4294967296000.0f) - a[j]) / (int64_t)(n - 1U);
+      db[j] = ((int64_t)(bf[j] * 4294967296000.0f) - b[j]) / (int64_t)(n - 1U);
+    }
+  }
+
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      acc = ((int64_t)xyz[(3U * i) + j] * a[j]) + b[j];
+      acc = (acc >= 0) ? ((acc + 2147483648) / 4294967296) :
+            -((2147483648 - acc) / 4294967296);
+      ug[(3U * i) + j] = (int32_t)acc;
+      a[j] += da[j];
+      b[j] += db[j];
+    }
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_calibration
+  * @brief     This section group the functions that estimate and apply
+  *            offset, gain and misalignment of the three axes
+  * @{
+  *
+  */
+
+/**
+  * @brief  Average of an array of acceleration raw samples, e.g. a static
+  *         pose acquired with lis3dhh_acceleration_raw_get or FIFO.
+  *
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  n       Number of samples.
+  * @param  avg     Average of X, Y, Z in LSB.(ptr)
+  *
+  */
+void lis3dhh_calib_average(const int16_t *xyz, size_t n, float_t *avg)
+{
+  int64_t sum[3] = { 0, 0, 0 };
+  size_t i;
+  uint8_t j;
+
+  for (i = 0U; i < n; i++)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      sum[j] += xyz[(3U * i) + j];
+    }
+  }
+
+  for (j = 0U; j < 3U; j++)
+  {
+    avg[j] = (n > 0U) ? ((float_t)sum[j] / (float_t)n) : 0.0f;
+  }
+}
+
+/**
+  * @brief  Reset the least squares accumulator.
+  *
+  * @param  acc     Least squares accumulator.(ptr)
+  *
+  */
+void lis3dhh_calib_acc_init(lis3dhh_calib_acc_t *acc)
+{
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    for (j = 0U; j < 4U; j++)
+    {
+      acc->ata[i][j] = 0.0f;
+    }
+
+    for (j = 0U; j < 3U; j++)
+    {
+      acc->atb[i][j] = 0.0f;
+    }
+  }
+
+  acc->num = 0U;
+}
+
+/**
+  * @brief  Add a pose to the least squares accumulator.
+  *         The model is ref = M * raw + off; poses can be added at any time
+  *         and the solution recomputed, e.g. the six +/-1 g positions in
+  *         production or further known orientations in the field.
+  *         Values are scaled to g internally to keep the normal equations
+  *         well conditioned.
+  *
+  * @param  acc     Least squares accumulator.(ptr)
+  * @param  raw     Averaged X, Y, Z in LSB, see lis3dhh_calib_average.(ptr)
+  * @param  ref     Expected X, Y, Z in mg, e.g. {0, 0, 1000}.(ptr)
+  *
+  */
+void lis3dhh_calib_acc_add(lis3dhh_calib_acc_t *acc, const float_t *raw,
+                           const float_t *ref)
+{
+  float_t u[4];
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    u[i] = raw[i] * 0.000076f;
+  }
+  u[3] = 1.0f;
+
+  for (i = 0U; i < 4U; i++)
+  {
+    for (j = 0U; j < 4U; j++)
+    {
+      acc->ata[i][j] += u[i] * u[j];
+    }
+
+    for (j = 0U; j < 3U; j++)
+    {
+      acc->atb[i][j] += u[i] * ref[j] * 0.001f;
+    }
+  }
+
+  acc->num++;
+}
+
+/**
+  * @brief  Solve the normal equations of the least squares accumulator.
+  *         At least four non coplanar poses are needed.
+  *
+  * @param  acc     Least squares accumulator.(ptr)
+  * @param  cal     Calibration.(ptr)
+  * @retval         0 -> no Error, -1 -> the poses do not determine the
+  *                 calibration.
+  *
+  */
+int32_t lis3dhh_calib_solve(const lis3dhh_calib_acc_t *acc,
+                            lis3dhh_calib_t *cal)
+{
+  float_t a[4][4];
+  float_t b[4][3];
+  float_t tmp;
+  float_t f;
+  uint8_t i;
+  uint8_t j;
+  uint8_t k;
+  uint8_t p;
+
+  if (acc->num < 4U)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < 4U; i++)
+  {
+    for (j = 0U; j < 4U; j++)
+    {
+      a[i][j] = acc->ata[i][j];
+    }
+
+    for (j = 0U; j < 3U; j++)
+    {
+      b[i][j] = acc->atb[i][j];
+    }
+  }
+
+  /* Gauss-Jordan elimination with partial pivoting */
+  for (k = 0U; k < 4U; k++)
+  {
+    p = k;
+
+    for (i = k + 1U; i < 4U; i++)
+    {
+      if (fabsf(a[i][k]) > fabsf(a[p][k]))
+      {
+        p = i;
+      }
+    }
+
+    if (fabsf(a[p][k]) < (1.0e-6f * (float_t)acc->num))
+    {
+      return -1;
+    }
+
+    for (j = 0U; j < 4U; j++)
+    {
+      tmp = a[k][j];
+      a[k][j] = a[p][j];
+      a[p][j] = tmp;
+    }
+
+    for (j = 0U; j < 3U; j++)
+    {
+      tmp = b[k][j];
+      b[k][j] = b[p][j];
+      b[p][j] = tmp;
+    }
+
+    for (i = 0U; i < 4U; i++)
+    {
+      if (i != k)
+      {
+        f = a[i][k] / a[k][k];
+
+        for (j = k; j < 4U; j++)
+        {
+          a[i][j] -= f * a[k][j];
+        }
+
+        for (j = 0U; j < 3U; j++)
+        {
+          b[i][j] -= f * b[k][j];
+        }
+      }
+    }
+  }
+
+  /* row i of b is the coefficient of u[i] for the three axes */
+  for (j = 0U; j < 3U; j++)
+  {
+    for (i = 0U; i < 3U; i++)
+    {
+      cal->m[j][i] = (b[i][j] / a[i][i]) * 0.076f;
+    }
+
+    cal->off[j] = (b[3][j] / a[3][3]) * 1000.0f;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Apply calibration to an array of acceleration raw samples.
+  *         Conversion to mg is part of the matrix, so each output is
+  *         three multiply-adds of the raw values.
+  *
+  * @param  cal     Calibration.(ptr)
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  n       Number of samples.
+  * @param  mg      Buffer of 3 * n values that stores calibrated
+  *                 acceleration in mg, may not overlap xyz.(ptr)
+  *
+  */
+void lis3dhh_calib_apply(const lis3dhh_calib_t *cal, const int16_t *xyz,
+                         size_t n, float_t *mg)
+{
+  float_t x;
+  float_t y;
+  float_t z;
+  size_t i;
+  uint8_t j;
+
+  for (i = 0U; i < n; i++)
+  {
+    x = (float_t)xyz[3U * i];
+    y = (float_t)xyz[(3U * i) + 1U];
+    z = (float_t)xyz[(3U * i) + 2U];
+
+    for (j = 0U; j < 3U; j++)
+    {
+      mg[(3U * i) + j] = (cal->m[j][0] * x) + (cal->m[j][1] * y) +
+                         (cal->m[j][2] * z) + cal->off[j];
+    }
+  }
+}
+
+/**
+  * @brief  Serialize calibration in LIS3DHH_CALIB_BLOB_LEN bytes.
+  *         Layout, little endian: version (1 byte), 9 x int16 deviation of
+  *         the matrix from nominal sensitivity (1 / 2^20, range +/-3.1 %),
+  *         3 x int16 offset (0.01 mg, range +/-327 mg), checksum (1 byte,
+  *         two's complement of the sum of the other bytes).
+  *
+  * @param  cal     Calibration.(ptr)
+  * @param  buff    Buffer of LIS3DHH_CALIB_BLOB_LEN bytes.(ptr)
+  * @retval         0 -> no Error, -1 -> a value is out of range.
+  *
+  */
+int32_t lis3dhh_calib_pack(const lis3dhh_calib_t *cal, uint8_t *buff)
+{
+  float_t v[12];
+  int32_t q;
+  uint8_t sum = 0U;
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      v[(3U * i) + j] = ((cal->m[i][j] / 0.076f) -
+                         ((i == j) ? 1.0f : 0.0f)) * 1048576.0f;
+    }
+
+    v[9U + i] = cal->off[i] * 100.0f;
+  }
+
+  buff[0] = 1U;
+
+  for (i = 0U; i < 12U; i++)
+  {
+    q = (int32_t)((v[i] >= 0.0f) ? (v[i] + 0.5f) : (v[i] - 0.5f));
+
+    if ((q > 32767) || (q < -32768))
+    {
+      return -1;
+    }
+
+    buff[1U + (2U * i)] = (uint8_t)((uint32_t)q & 0xFFU);
+    buff[2U + (2U * i)] = (uint8_t)(((uint32_t)q >> 8) & 0xFFU);
+  }
+
+  for (i = 0U; i < (LIS3DHH_CALIB_BLOB_LEN - 1U); i++)
+  {
+    sum += buff[i];
+  }
+
+  buff[LIS3DHH_CALIB_BLOB_LEN - 1U] = (uint8_t)(0x100U - sum);
+
+  return 0;
+}
+
+/**
+  * @brief  Deserialize calibration written by lis3dhh_calib_pack.
+  *
+  * @param  buff    Buffer of LIS3DHH_CALIB_BLOB_LEN bytes.(ptr)
+  * @param  cal     Calibration.(ptr)
+  * @retval         0 -> no Error, -1 -> version or checksum do not match.
+  *
+  */
+int32_t lis3dhh_calib_unpack(const uint8_t *buff, lis3dhh_calib_t *cal)
+{
+  float_t v[12];
+  int16_t q;
+  uint8_t sum = 0U;
+  uint8_t i;
+  uint8_t j;
+
+  for (i = 0U; i < LIS3DHH_CALIB_BLOB_LEN; i++)
+  {
+    sum += buff[i];
+  }
+
+  if ((buff[0] != 1U) || (sum != 0U))
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < 12U; i++)
+  {
+    q = (int16_t)buff[2U + (2U * i)];
+    q = (q * 256) + (int16_t)buff[1U + (2U * i)];
+    v[i] = (float_t)q;
+  }
+
+  for (i = 0U; i < 3U; i++)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      cal->m[i][j] = ((v[(3U * i) + j] / 1048576.0f) +
+                      ((i == j) ? 1.0f : 0.0f)) * 0.076f;
+    }
+
+    cal->off[i] = v[9U + i] / 100.0f;
+  }
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_compression
+  * @brief     This section group the functions that encode and decode
+  *            acceleration raw data in a compact block format
+  * @{
+  *
+  */
+
+/**
+  * @brief  Reset encoder or decoder state.
+  *         A block is encoded as:
+  *         - header: number of samples (bits 0..5), keyframe flag (bit 7);
+  *         - keyframe only: first sample, X, Y, Z as little endian int16;
+  *         - for X, Y, Z: bit width w (1 byte) followed by the zigzag
+  *           coded differences from the previous sample, w bits each,
+  *           LSB first, padded to a byte.
+  *         A keyframe does not depend on previous blocks, so decoding can
+  *         start at any keyframe.
+  *
+  * @param  pk            Encoder or decoder state.(ptr)
+  * @param  key_interval  Encoder: a keyframe is written every
+  *                       key_interval blocks, 0 or 1 for keyframes only.
+  *                       Decoder: unused.
+  *
+  */
+void lis3dhh_pack_init(lis3dhh_pack_t *pk, uint16_t key_interval)
+{
+  pk->prev[0] = 0;
+  pk->prev[1] = 0;
+  pk->prev[2] = 0;
+  pk->key_interval = key_interval;
+  pk->cnt = 0U;
+  pk->valid = 0U;
+}
+
+/**
+  * @brief  Encode a block of acceleration raw samples.
+  *
+  * @param  pk      Encoder state.(ptr)
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  num     Number of samples, 1 to LIS3DHH_PACK_BLOCK.
+  * @param  buff    Buffer of at least LIS3DHH_PACK_MAX_LEN bytes.(ptr)
+  * @retval         Number of bytes written, 0 if num is out of range.
+  *
+  */
+uint16_t lis3dhh_pack_encode(lis3dhh_pack_t *pk, const int16_t *xyz,
+                             uint8_t num, uint8_t *buff)
+{
+  uint32_t zz[LIS3DHH_PACK_BLOCK];
+  uint32_t acc;
+  uint32_t max;
+  int32_t d;
+  uint16_t len = 1U;
+  uint8_t bits;
+  uint8_t w;
+  uint8_t i;
+  uint8_t j;
+
+  if ((num == 0U) || (num > LIS3DHH_PACK_BLOCK))
+  {
+    return 0U;
+  }
+
+  buff[0] = num;
+
+  if ((pk->valid == 0U) || (pk->cnt == 0U))
+  {
+    buff[0] |= 0x80U;
+
+    for (j = 0U; j < 3U; j++)
+    {
+      pk->prev[j] = xyz[j];
+      buff[len] = (uint8_t)((uint16_t)xyz[j] & 0xFFU);
+      buff[len + 1U] = (uint8_t)((uint16_t)xyz[j] >> 8);
+      len += 2U;
+    }
+
+    pk->valid = 1U;
+  }
+
+  pk->cnt++;
+
+  if (pk->cnt >= pk->key_interval)
+  {
+    pk->cnt = 0U;
+  }
+
+  for (j = 0U; j < 3U; j++)
+  {
+    max = 0U;
+
+    for (i = 0U; i < num; i++)
+    {
+      d = (int32_t)xyz[(3U * i) + j] - (int32_t)pk->prev[j];
+      zz[i] = (d >= 0) ? ((uint32_t)d * 2U) : (((uint32_t)(-d) * 2U) - 1U);
+      max |= zz[i];
+      pk->prev[j] = xyz[(3U * i) + j];
+    }
+
+    w = 0U;
+
+    while ((max >> w) != 0U)
+    {
+      w++;
+    }
+
+    buff[len] = w;
+    len++;
+    acc = 0U;
+    bits = 0U;
+
+    for (i = 0U; i < num; i++)
+    {
+      acc |= zz[i] << bits;
+      bits += w;
+
+      while (bits >= 8U)
+      {
+        buff[len] = (uint8_t)(acc & 0xFFU);
+        len++;
+        acc >>= 8;
+        bits -= 8U;
+      }
+    }
+
+    if (bits > 0U)
+    {
+      buff[len] = (uint8_t)(acc & 0xFFU);
+      len++;
+    }
+  }
+
+  return len;
+}
+
+/**
+  * @brief  Decode a block of acceleration raw samples.
+  *         Blocks that are not keyframes are skipped until a keyframe has
+  *         been decoded, so decoding can be started at any block.
+  *
+  * @param  pk      Decoder state.(ptr)
+  * @param  buff    Encoded data.(ptr)
+  * @param  len     Number of bytes available in buff.
+  * @param  xyz     Buffer of 3 * LIS3DHH_PACK_BLOCK values that stores
+  *                 samples, X, Y, Z interleaved.(ptr)
+  * @param  num     Number of samples decoded, 0 if the block was
+  *                 skipped.(ptr)
+  * @param  used    Number of bytes of the block.(ptr)
+  * @retval         0 -> no Error, -1 -> the block is truncated or
+  *                 malformed.
+  *
+  */
+int32_t lis3dhh_pack_decode(lis3dhh_pack_t *pk, const uint8_t *buff,
+                            uint16_t len, int16_t *xyz, uint8_t *num,
+                            uint16_t *used)
+{
+  uint32_t acc;
+  uint32_t zz;
+  int32_t d;
+  uint16_t pos = 1U;
+  uint16_t size;
+  uint8_t bits;
+  uint8_t key;
+  uint8_t n;
+  uint8_t w;
+  uint8_t i;
+  uint8_t j;
+
+  *num = 0U;
+  *used = 0U;
+
+  if (len == 0U)
+  {
+    return -1;
+  }
+
+  n = buff[0] & 0x3FU;
+  key = ((buff[0] & 0x80U) != 0U) ? 1U : 0U;
+
+  if ((n == 0U) || (n > LIS3DHH_PACK_BLOCK))
+  {
+    return -1;
+  }
+
+  /* block size is known from header and widths */
+  if (key == 1U)
+  {
+    pos += 6U;
+  }
+
+  for (j = 0U; j < 3U; j++)
+  {
+    if ((pos >= len) || (buff[pos] > 17U))
+    {
+      return -1;
+    }
+
+    size = (((uint16_t)n * buff[pos]) + 7U) / 8U;
+    pos += 1U + size;
+  }
+
+  if (pos > len)
+  {
+    return -1;
+  }
+
+  *used = pos;
+
+  if (key == 1U)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      pk->prev[j] = (int16_t)buff[2U + (2U * j)];
+      pk->prev[j] = (pk->prev[j] * 256) + (int16_t)buff[1U + (2U * j)];
+    }
+
+    pk->valid = 1U;
+    pos = 7U;
+  }
+
+  else if (pk->valid == 0U)
+  {
+    return 0;
+  }
+
+  else
+  {
+    pos = 1U;
+  }
+
+  for (j = 0U; j < 3U; j++)
+  {
+    w = buff[pos];
+    pos++;
+    acc = 0U;
+    bits = 0U;
+
+    for (i = 0U; i < n; i++)
+    {
+      while (bits < w)
+      {
+        acc |= (uint32_t)buff[pos] << bits;
+        pos++;
+        bits += 8U;
+      }
+
+      zz = (w == 0U) ? 0U : (acc & (0xFFFFFFFFU >> (32U - w)));
+      acc >>= w;
+      bits -= w;
+      d = ((zz & 1U) != 0U) ? -(int32_t)((zz + 1U) / 2U) : (int32_t)(zz / 2U);
+      pk->prev[j] = (int16_t)((int32_t)pk->prev[j] + d);
+      xyz[(3U * i) + j] = pk->prev[j];
+    }
+  }
+
+  *num = n;
+
+  return 0;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_decimation
+  * @brief     This section group the functions of the CIC decimator
+  * @{
+  *
+  */
+
+/**
+  * @brief  Initialize the CIC decimator.
+  *
+  * @param  cic     CIC decimator.(ptr)
+  * @param  order   Number of integrator / comb stages, 1 (moving average)
+  *                 to LIS3DHH_CIC_MAX_ORDER.
+  * @param  ratio   Decimation ratio, at least 1.
+  * @retval         0 -> no Error, -1 -> parameter not allowed.
+  *
+  */
+int32_t lis3dhh_cic_init(lis3dhh_cic_t *cic, uint8_t order,
+                         uint16_t ratio)
+{
+  uint64_t gain = 1U;
+  uint8_t i;
+  uint8_t a;
+
+  if ((order == 0U) || (order > LIS3DHH_CIC_MAX_ORDER) || (ratio == 0U))
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < order; i++)
+  {
+    gain *= ratio;
+  }
+
+  if (gain > 0x100000000ULL)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < LIS3DHH_CIC_MAX_ORDER; i++)
+  {
+    for (a = 0U; a < 3U; a++)
+    {
+      cic->integ[i][a] = 0U;
+      cic->comb[i][a] = 0U;
+    }
+  }
+
+  cic->gain = gain;
+  cic->ratio = ratio;
+  cic->phase = 0U;
+  cic->order = order;
+
+  return 0;
+}
+
+/**
+  * @brief  Feed samples to the CIC decimator. One output sample is
+  *         produced every ratio input samples; the first order - 1
+  *         outputs are the filter transient.
+  *
+  * @param  cic     CIC decimator.(ptr)
+  * @param  xyz     Input samples, X, Y, Z interleaved (e.g. as returned
+  *                 by lis3dhh_fifo_data_get).(ptr)
+  * @param  num     Number of input samples.
+  * @param  out     Buffer of 3 * (num / ratio + 1) values that stores the
+  *                 output samples, X, Y, Z interleaved, LSB Q8.(ptr)
+  * @retval         Number of output samples.
+  *
+  */
+uint16_t lis3dhh_cic_process(lis3dhh_cic_t *cic, const int16_t *xyz,
+                             uint16_t num, int32_t *out)
+{
+  uint64_t v;
+  uint64_t tmp;
+  int64_t y;
+  uint16_t n = 0U;
+  uint16_t k;
+  uint8_t i;
+  uint8_t a;
+
+  for (k = 0U; k < num; k++)
+  {
+    /* integrators run at input rate, wrap-around is intended */
+    for (a = 0U; a < 3U; a++)
+    {
+      cic->integ[0][a] += (uint64_t)(int64_t)xyz[(3U * k) + a];
+
+      for (i = 1U; i < cic->order; i++)
+      {
+        cic->integ[i][a] += cic->integ[i - 1U][a];
+      }
+    }
+
+    cic->phase++;
+
+    if (cic->phase == cic->ratio)
+    {
+      cic->phase = 0U;
+
+      /* combs run at output rate */
+      for (a = 0U; a < 3U; a++)
+      {
+        v = cic->integ[cic->order - 1U][a];
+
+        for (i = 0U; i < cic->order; i++)
+        {
+          tmp = v;
+          v -= cic->comb[i][a];
+          cic->comb[i][a] = tmp;
+        }
+
+        y = (int64_t)v * 256;
+
+        if (y >= 0)
+        {
+          y = (y + (int64_t)(cic->gain / 2U)) / (int64_t)cic->gain;
+        }
+
+        else
+        {
+          y = -((-y + (int64_t)(cic->gain / 2U)) / (int64_t)cic->gain);
+        }
+
+        out[(3U * n) + a] = (int32_t)y;
+      }
+
+      n++;
+    }
+  }
+
+  return n;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  LIS3DHH_health_monitor
+  * @brief     This section group the functions that count data path
+  *            anomalies without bus access
+  * @{
+  *
+  */
+
+/**
+  * @brief  Reset the health counters.
+  *
+  * @param  h       Health monitor.(ptr)
+  *
+  */
+void lis3dhh_health_init(lis3dhh_health_t *h)
+{
+  h->cnt.samples = 0U;
+  h->cnt.stale = 0U;
+  h->cnt.lost = 0U;
+  h->cnt.xl_ovr = 0U;
+  h->cnt.fifo_ovr = 0U;
+  h->cnt.fth = 0U;
+  h->cnt.repeated = 0U;
+  h->cnt.stuck = 0U;
+  h->cnt.saturated = 0U;
+  h->cnt.latency_max = 0U;
+  h->seq = 0U;
+  h->last = 0U;
+  h->prev[0] = 0;
+  h->prev[1] = 0;
+  h->prev[2] = 0;
+  h->run[0] = 0U;
+  h->run[1] = 0U;
+  h->run[2] = 0U;
+  h->valid = 0U;
+}
+
+/**
+  * @brief  Update sample and service latency counters.
+  *
+  * @param  h       Health monitor.(ptr)
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  num     Number of samples.
+  * @param  now     Current time, any unit.
+  *
+  */
+static void lis3dhh_health_data_update(lis3dhh_health_t *h,
+                                       const int16_t *xyz, uint16_t num,
+                                       uint32_t now)
+{
+  uint16_t i;
+  uint8_t same;
+  uint8_t j;
+
+  if ((h->valid != 0U) && ((now - h->last) > h->cnt.latency_max))
+  {
+    h->cnt.latency_max = now - h->last;
+  }
+
+  h->last = now;
+
+  for (i = 0U; i < num; i++)
+  {
+    same = 0U;
+
+    for (j = 0U; j < 3U; j++)
+    {
+      if ((xyz[(3U * i) + j] == INT16_MIN) ||
+          (xyz[(3U * i) + j] == INT16_MAX))
+      {
+        h->cnt.saturated++;
+      }
+
+      if ((h->valid != 0U) && (xyz[(3U * i) + j] == h->prev[j]))
+      {
+        same++;
+
+        if (h->run[j] < LIS3DHH_HEALTH_STUCK)
+        {
+          h->run[j]++;
+
+          if (h->run[j] == LIS3DHH_HEALTH_STUCK)
+          {
+            h->cnt.stuck++;
+          }
+        }
+      }
+
+      else
+      {
+        h->run[j] = 1U;
+      }
+
+      h->prev[j] = xyz[(3U * i) + j];
+    }
+
+    if (same == 3U)
+    {
+      h->cnt.repeated++;
+    }
+
+    h->valid = 1U;
+  }
+
+  h->cnt.samples += num;
+}
+
+/**
+  * @brief  Update health counters from a single sample read, e.g. with
+  *         lis3dhh_snapshot_raw_get.
+  *         If zyxda is not set the sample was already read: it only
+  *         counts as stale and is not checked again.
+  *
+  * @param  h       Health monitor.(ptr)
+  * @param  status  STATUS read with the sample.(ptr)
+  * @param  xyz     Sample, X, Y, Z.(ptr)
+  * @param  now     Current time, any unit.
+  *
+  */
+void lis3dhh_health_status_update(lis3dhh_health_t *h,
+                                  const lis3dhh_status_t *status,
+                                  const int16_t *xyz, uint32_t now)
+{
+  h->seq++;
+  LIS3DHH_MEM_BARRIER();
+
+  if (status->zyxor != 0U)
+  {
+    h->cnt.xl_ovr++;
+    h->cnt.lost++;
+  }
+
+  if (status->zyxda == 0U)
+  {
+    h->cnt.stale++;
+  }
+
+  else
+  {
+    lis3dhh_health_data_update(h, xyz, 1U, now);
+  }
+
+  LIS3DHH_MEM_BARRIER();
+  h->seq++;
+}
+
+/**
+  * @brief  Update health counters from a FIFO drain, e.g. with
+  *         lis3dhh_fifo_data_status_get.
+  *
+  * @param  h       Health monitor.(ptr)
+  * @param  status  FIFO_SRC read before the samples.(ptr)
+  * @param  xyz     Samples, X, Y, Z interleaved.(ptr)
+  * @param  read    Number of samples.
+  * @param  now     Current time, any unit.
+  *
+  */
+void lis3dhh_health_fifo_update(lis3dhh_health_t *h,
+                                const lis3dhh_fifo_src_t *status,
+                                const int16_t *xyz, uint16_t read,
+                                uint32_t now)
+{
+  h->seq++;
+  LIS3DHH_MEM_BARRIER();
+
+  if (status->ovrn != 0U)
+  {
+    h->cnt.fifo_ovr++;
+    h->cnt.lost++;
+  }
+
+  if (status->fth != 0U)
+  {
+    h->cnt.fth++;
+  }
+
+  lis3dhh_health_data_update(h, xyz, read, now);
+
+  LIS3DHH_MEM_BARRIER();
+  h->seq++;
+}
+
+/**
+  * @brief  Consistent copy of the health counters.[get]
+  *         May be called from a context other than the one updating the
+  *         counters (e.g. telemetry task): the copy is retried if an
+  *         update happens meanwhile.
+  *
+  * @param  h       Health monitor.(ptr)
+  * @param  val     Counters.(ptr)
+  *
+  */
+void lis3dhh_health_get(const lis3dhh_health_t *h,
+                        lis3dhh_health_cnt_t *val)
+{
+  uint32_t seq;
+
+  do
+  {
+    seq = h->seq;
+    LIS3DHH_MEM_BARRIER();
+    *val = h->cnt;
+    LIS3DHH_MEM_BARRIER();
+  } while (((seq & 1U) != 0U) || (seq != h->seq));
+}
+
 /**
   * @}
   *
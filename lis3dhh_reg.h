@@ -119,6 +119,9 @@ typedef struct
   stmdev_read_ptr   read_reg;
   /** Customizable optional pointer **/
   void *handle;
+
+  /** private data **/
+  void *priv_data;
 } stmdev_ctx_t;
 
 /**
@@ -195,6 +198,18 @@ typedef struct
   uint8_t bdu              : 1;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_ctrl_reg1_t;
+#define LIS3DHH_CTRL_REG1_BDU_POS             0U
+#define LIS3DHH_CTRL_REG1_BDU_MSK             0x01U
+#define LIS3DHH_CTRL_REG1_DRDY_PULSE_POS      1U
+#define LIS3DHH_CTRL_REG1_DRDY_PULSE_MSK      0x02U
+#define LIS3DHH_CTRL_REG1_SW_RESET_POS        2U
+#define LIS3DHH_CTRL_REG1_SW_RESET_MSK        0x04U
+#define LIS3DHH_CTRL_REG1_BOOT_POS            3U
+#define LIS3DHH_CTRL_REG1_BOOT_MSK            0x08U
+#define LIS3DHH_CTRL_REG1_IF_ADD_INC_POS      6U
+#define LIS3DHH_CTRL_REG1_IF_ADD_INC_MSK      0x40U
+#define LIS3DHH_CTRL_REG1_NORM_MOD_EN_POS     7U
+#define LIS3DHH_CTRL_REG1_NORM_MOD_EN_MSK     0x80U
 
 #define LIS3DHH_INT1_CTRL     0x21U
 typedef struct
@@ -217,6 +232,18 @@ typedef struct
   uint8_t not_used_01      : 2;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_int1_ctrl_t;
+#define LIS3DHH_INT1_CTRL_INT1_EXT_POS        2U
+#define LIS3DHH_INT1_CTRL_INT1_EXT_MSK        0x04U
+#define LIS3DHH_INT1_CTRL_INT1_FTH_POS        3U
+#define LIS3DHH_INT1_CTRL_INT1_FTH_MSK        0x08U
+#define LIS3DHH_INT1_CTRL_INT1_FSS5_POS       4U
+#define LIS3DHH_INT1_CTRL_INT1_FSS5_MSK       0x10U
+#define LIS3DHH_INT1_CTRL_INT1_OVR_POS        5U
+#define LIS3DHH_INT1_CTRL_INT1_OVR_MSK        0x20U
+#define LIS3DHH_INT1_CTRL_INT1_BOOT_POS       6U
+#define LIS3DHH_INT1_CTRL_INT1_BOOT_MSK       0x40U
+#define LIS3DHH_INT1_CTRL_INT1_DRDY_POS       7U
+#define LIS3DHH_INT1_CTRL_INT1_DRDY_MSK       0x80U
 
 #define LIS3DHH_INT2_CTRL     0x22U
 typedef struct
@@ -237,6 +264,16 @@ typedef struct
   uint8_t not_used_01      : 3;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_int2_ctrl_t;
+#define LIS3DHH_INT2_CTRL_INT2_FTH_POS        3U
+#define LIS3DHH_INT2_CTRL_INT2_FTH_MSK        0x08U
+#define LIS3DHH_INT2_CTRL_INT2_FSS5_POS       4U
+#define LIS3DHH_INT2_CTRL_INT2_FSS5_MSK       0x10U
+#define LIS3DHH_INT2_CTRL_INT2_OVR_POS        5U
+#define LIS3DHH_INT2_CTRL_INT2_OVR_MSK        0x20U
+#define LIS3DHH_INT2_CTRL_INT2_BOOT_POS       6U
+#define LIS3DHH_INT2_CTRL_INT2_BOOT_MSK       0x40U
+#define LIS3DHH_INT2_CTRL_INT2_DRDY_POS       7U
+#define LIS3DHH_INT2_CTRL_INT2_DRDY_MSK       0x80U
 
 #define LIS3DHH_CTRL_REG4     0x23U
 typedef struct
@@ -255,6 +292,14 @@ typedef struct
   uint8_t not_used_01      : 1;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_ctrl_reg4_t;
+#define LIS3DHH_CTRL_REG4_FIFO_EN_POS         1U
+#define LIS3DHH_CTRL_REG4_FIFO_EN_MSK         0x02U
+#define LIS3DHH_CTRL_REG4_PP_OD_POS           2U
+#define LIS3DHH_CTRL_REG4_PP_OD_MSK           0x0CU
+#define LIS3DHH_CTRL_REG4_ST_POS              4U
+#define LIS3DHH_CTRL_REG4_ST_MSK              0x30U
+#define LIS3DHH_CTRL_REG4_DSP_POS             6U
+#define LIS3DHH_CTRL_REG4_DSP_MSK             0xC0U
 
 #define LIS3DHH_CTRL_REG5     0x24U
 typedef struct
@@ -267,6 +312,8 @@ typedef struct
   uint8_t fifo_spi_hs_on   : 1;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_ctrl_reg5_t;
+#define LIS3DHH_CTRL_REG5_FIFO_SPI_HS_ON_POS  0U
+#define LIS3DHH_CTRL_REG5_FIFO_SPI_HS_ON_MSK  0x01U
 
 #define LIS3DHH_OUT_TEMP_L    0x25U
 #define LIS3DHH_OUT_TEMP_H    0x26U
@@ -293,6 +340,22 @@ typedef struct
   uint8_t xda              : 1;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_status_t;
+#define LIS3DHH_STATUS_XDA_POS                0U
+#define LIS3DHH_STATUS_XDA_MSK                0x01U
+#define LIS3DHH_STATUS_YDA_POS                1U
+#define LIS3DHH_STATUS_YDA_MSK                0x02U
+#define LIS3DHH_STATUS_ZDA_POS                2U
+#define LIS3DHH_STATUS_ZDA_MSK                0x04U
+#define LIS3DHH_STATUS_ZYXDA_POS              3U
+#define LIS3DHH_STATUS_ZYXDA_MSK              0x08U
+#define LIS3DHH_STATUS_XOR_POS                4U
+#define LIS3DHH_STATUS_XOR_MSK                0x10U
+#define LIS3DHH_STATUS_YOR_POS                5U
+#define LIS3DHH_STATUS_YOR_MSK                0x20U
+#define LIS3DHH_STATUS_ZOR_POS                6U
+#define LIS3DHH_STATUS_ZOR_MSK                0x40U
+#define LIS3DHH_STATUS_ZYXOR_POS              7U
+#define LIS3DHH_STATUS_ZYXOR_MSK              0x80U
 
 #define LIS3DHH_OUT_X_L_XL    0x28U
 #define LIS3DHH_OUT_X_H_XL    0x29U
@@ -311,6 +374,10 @@ typedef struct
   uint8_t fth              : 5;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_fifo_ctrl_t;
+#define LIS3DHH_FIFO_CTRL_FTH_POS             0U
+#define LIS3DHH_FIFO_CTRL_FTH_MSK             0x1FU
+#define LIS3DHH_FIFO_CTRL_FMODE_POS           5U
+#define LIS3DHH_FIFO_CTRL_FMODE_MSK           0xE0U
 
 #define LIS3DHH_FIFO_SRC      0x2FU
 typedef struct
@@ -325,6 +392,12 @@ typedef struct
   uint8_t fss              : 6;
 #endif /* DRV_BYTE_ORDER */
 } lis3dhh_fifo_src_t;
+#define LIS3DHH_FIFO_SRC_FSS_POS              0U
+#define LIS3DHH_FIFO_SRC_FSS_MSK              0x3FU
+#define LIS3DHH_FIFO_SRC_OVRN_POS             6U
+#define LIS3DHH_FIFO_SRC_OVRN_MSK             0x40U
+#define LIS3DHH_FIFO_SRC_FTH_POS              7U
+#define LIS3DHH_FIFO_SRC_FTH_MSK              0x80U
 
 /**
   * @defgroup LIS3DHH_Register_Union
@@ -352,6 +425,101 @@ typedef union
   uint8_t                byte;
 } lis3dhh_reg_t;
 
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup LIS3DHH_Shadow_registers
+  * @brief    RAM copy of the writable control registers (CTRL_REG1,
+  *           INT1_CTRL, INT2_CTRL, CTRL_REG4, CTRL_REG5, FIFO_CTRL).
+  *
+  *           The shadow is compiled in only if LIS3DHH_SHADOW_REG is
+  *           defined and it is used only when attached to the context
+  *           with lis3dhh_shadow_attach(), so in that build ctx->priv_data
+  *           MUST be initialized (NULL if not used).
+  *           When active, configuration getters and the read phase of
+  *           the read-modify-write setters do not access the bus.
+  *
+  * @{
+  *
+  */
+
+#define LIS3DHH_SHADOW_NUM    6U
+
+typedef struct
+{
+  uint8_t valid;
+  uint8_t reg[LIS3DHH_SHADOW_NUM];
+} lis3dhh_shadow_t;
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup LIS3DHH_Bus_trace
+  * @brief    Record of the bus transactions done by lis3dhh_read_reg and
+  *           lis3dhh_write_reg, with latency histograms per register.
+  *
+  *           The trace is compiled in only if LIS3DHH_TRACE is defined;
+  *           in that build LIS3DHH_TRACE_TIME() MUST be defined too and
+  *           return a free running uint32_t tick counter (e.g. DWT
+  *           CYCCNT on Cortex-M). Otherwise the driver is unchanged.
+  *           The trace is shared by all the contexts and is filled only
+  *           when attached with lis3dhh_trace_attach(). Recording is not
+  *           atomic: it supports a single writer, so all the traced
+  *           transactions (of every context) MUST be issued from one
+  *           execution context, e.g. one task with no bus access from
+  *           interrupts, or be serialized by the application (the same
+  *           lock that serializes the shared bus). Reading with
+  *           lis3dhh_trace_read() is allowed from any other context.
+  *           Each context to be told apart (e.g. several sensors on the
+  *           same bus) is registered with lis3dhh_trace_dev_add(), which
+  *           gives its device id: entries carry it and histograms are
+  *           kept per device. Transactions of contexts not registered are
+  *           recorded with id LIS3DHH_TRACE_DEV_NONE and not counted in
+  *           the histograms. hist takes LIS3DHH_TRACE_DEV_NUM * 33 * 16 *
+  *           4 bytes, LIS3DHH_TRACE_DEV_NUM can be defined at build time.
+  *
+  * @{
+  *
+  */
+
+#ifndef LIS3DHH_TRACE_DEV_NUM
+#define LIS3DHH_TRACE_DEV_NUM    8U
+#endif /* LIS3DHH_TRACE_DEV_NUM */
+
+#define LIS3DHH_TRACE_DEV_NONE   0xFFU
+#define LIS3DHH_TRACE_BUCKETS    16U
+#define LIS3DHH_TRACE_REG_NUM    (LIS3DHH_FIFO_SRC - LIS3DHH_WHO_AM_I + 1U)
+#define LIS3DHH_TRACE_CSV_LEN    52U
+#define LIS3DHH_TRACE_HIST_CSV_LEN  (10U + (11U * LIS3DHH_TRACE_BUCKETS))
+
+typedef struct
+{
+  uint32_t time;
+  uint32_t dur;
+  int32_t status;
+  uint16_t len;
+  uint8_t reg;
+  uint8_t wr;
+  uint8_t dev;
+} lis3dhh_trace_entry_t;
+
+typedef struct
+{
+  lis3dhh_trace_entry_t *buff;
+  uint16_t mask;
+  volatile uint32_t head;
+  const stmdev_ctx_t *dev[LIS3DHH_TRACE_DEV_NUM];
+  uint8_t dev_num;
+  /* log2 buckets: [0] dur 0, [k] dur in [2^(k-1), 2^k), last bucket more */
+  uint32_t hist[LIS3DHH_TRACE_DEV_NUM][LIS3DHH_TRACE_REG_NUM][LIS3DHH_TRACE_BUCKETS];
+} lis3dhh_trace_t;
+
 /**
   * @}
   *
@@ -364,9 +532,44 @@ int32_t lis3dhh_write_reg(stmdev_ctx_t *ctx, uint8_t reg,
                           uint8_t *data,
                           uint16_t len);
 
+#if defined(LIS3DHH_SHADOW_REG)
+int32_t lis3dhh_shadow_attach(stmdev_ctx_t *ctx, lis3dhh_shadow_t *val);
+int32_t lis3dhh_shadow_invalidate(stmdev_ctx_t *ctx);
+#endif /* LIS3DHH_SHADOW_REG */
+
+#if defined(LIS3DHH_TRACE)
+int32_t lis3dhh_trace_init(lis3dhh_trace_t *tr,
+                           lis3dhh_trace_entry_t *buff, uint16_t size);
+int32_t lis3dhh_trace_dev_add(lis3dhh_trace_t *tr, const stmdev_ctx_t *ctx,
+                              uint8_t *id);
+void lis3dhh_trace_attach(lis3dhh_trace_t *tr);
+uint16_t lis3dhh_trace_read(lis3dhh_trace_t *tr, uint32_t *seq,
+                            lis3dhh_trace_entry_t *val, uint16_t max);
+uint16_t lis3dhh_trace_csv_get(const lis3dhh_trace_entry_t *val,
+                               char *buff);
+uint16_t lis3dhh_trace_hist_csv_get(const lis3dhh_trace_t *tr, uint8_t dev,
+                                    uint8_t reg, char *buff);
+#endif /* LIS3DHH_TRACE */
+
 float_t lis3dhh_from_lsb_to_mg(int16_t lsb);
 float_t lis3dhh_from_lsb_to_celsius(int16_t lsb);
 
+void lis3dhh_from_lsb_to_mg_array(const int16_t *in, float_t *out,
+                                  size_t n);
+void lis3dhh_from_lsb_to_celsius_array(const int16_t *in, float_t *out,
+                                       size_t n);
+
+int32_t lis3dhh_from_lsb_to_ug(int16_t lsb);
+int32_t lis3dhh_from_lsb_to_mg_q16(int16_t lsb);
+int32_t lis3dhh_from_lsb_to_centicelsius(int16_t lsb);
+
+void lis3dhh_from_lsb_to_ug_array(const int16_t *in, int32_t *out,
+                                  size_t n);
+void lis3dhh_from_lsb_to_mg_q16_array(const int16_t *in, int32_t *out,
+                                      size_t n);
+void lis3dhh_from_lsb_to_centicelsius_array(const int16_t *in,
+                                            int32_t *out, size_t n);
+
 int32_t lis3dhh_block_data_update_set(stmdev_ctx_t *ctx, uint8_t val);
 int32_t lis3dhh_block_data_update_get(stmdev_ctx_t *ctx,
                                       uint8_t *val);
@@ -384,10 +587,25 @@ int32_t lis3dhh_data_rate_get(stmdev_ctx_t *ctx,
 int32_t lis3dhh_temperature_raw_get(stmdev_ctx_t *ctx, int16_t *val);
 int32_t lis3dhh_acceleration_raw_get(stmdev_ctx_t *ctx, int16_t *val);
 
+void lis3dhh_temperature_raw_decode(const uint8_t *buff, int16_t *val);
+void lis3dhh_acceleration_raw_decode(const uint8_t *buff, int16_t *val);
+void lis3dhh_raw_decode(const uint8_t *buff, int16_t *val, size_t n);
+
 int32_t lis3dhh_xl_data_ready_get(stmdev_ctx_t *ctx, uint8_t *val);
 
 int32_t lis3dhh_xl_data_ovr_get(stmdev_ctx_t *ctx, uint8_t *val);
 
+typedef struct
+{
+  int16_t temp;
+  lis3dhh_status_t status;
+  int16_t xl[3];
+} lis3dhh_snapshot_t;
+int32_t lis3dhh_snapshot_raw_get(stmdev_ctx_t *ctx,
+                                 lis3dhh_snapshot_t *val);
+void lis3dhh_snapshot_raw_decode(const uint8_t *buff,
+                                 lis3dhh_snapshot_t *val);
+
 int32_t lis3dhh_device_id_get(stmdev_ctx_t *ctx, uint8_t *buff);
 
 int32_t lis3dhh_reset_set(stmdev_ctx_t *ctx, uint8_t val);
@@ -518,9 +736,460 @@ int32_t lis3dhh_fifo_ovr_flag_get(stmdev_ctx_t *ctx, uint8_t *val);
 
 int32_t lis3dhh_fifo_fth_flag_get(stmdev_ctx_t *ctx, uint8_t *val);
 
+#define LIS3DHH_FIFO_DEPTH    32U
+int32_t lis3dhh_fifo_data_get(stmdev_ctx_t *ctx, int16_t *xyz,
+                              uint16_t max_samples, uint16_t *read);
+int32_t lis3dhh_fifo_data_status_get(stmdev_ctx_t *ctx, int16_t *xyz,
+                                     uint16_t max_samples, uint16_t *read,
+                                     lis3dhh_fifo_src_t *status);
+void lis3dhh_fifo_data_decode(const uint8_t *buff, int16_t *xyz,
+                              uint16_t num);
+
+/* Non-blocking FIFO read (lis3dhh_fifo_async_*): the state MUST be set up
+ * with lis3dhh_fifo_async_init. Return values follow 0 -> no Error; the
+ * end of the read is reported by the done parameter of
+ * lis3dhh_fifo_async_complete. */
+typedef struct
+{
+  stmdev_read_ptr submit;   /* starts a read, must not wait for the end */
+  int16_t *xyz;
+  uint16_t max_samples;
+  uint16_t read;
+  lis3dhh_fifo_src_t status;
+  uint8_t state;            /* 0: idle, 1: FIFO_SRC, 2: samples */
+} lis3dhh_fifo_async_t;
+void lis3dhh_fifo_async_init(lis3dhh_fifo_async_t *fa,
+                             stmdev_read_ptr submit);
+int32_t lis3dhh_fifo_async_start(stmdev_ctx_t *ctx, lis3dhh_fifo_async_t *fa,
+                                 int16_t *xyz, uint16_t max_samples);
+int32_t lis3dhh_fifo_async_complete(stmdev_ctx_t *ctx,
+                                    lis3dhh_fifo_async_t *fa, int32_t ret,
+                                    uint8_t *done);
+
+#ifndef LIS3DHH_BLOCK_ALIGN
+#if defined(__GNUC__)
+#define LIS3DHH_BLOCK_ALIGN     __attribute__((aligned(16)))
+#else
+#define LIS3DHH_BLOCK_ALIGN
+#endif /* __GNUC__ */
+#endif /* LIS3DHH_BLOCK_ALIGN */
+
+typedef struct
+{
+  int16_t x[LIS3DHH_FIFO_DEPTH] LIS3DHH_BLOCK_ALIGN;
+  int16_t y[LIS3DHH_FIFO_DEPTH] LIS3DHH_BLOCK_ALIGN;
+  int16_t z[LIS3DHH_FIFO_DEPTH] LIS3DHH_BLOCK_ALIGN;
+  uint16_t num;
+} lis3dhh_block_t;
+int32_t lis3dhh_fifo_block_get(stmdev_ctx_t *ctx, lis3dhh_block_t *blk,
+                               lis3dhh_fifo_src_t *status);
+void lis3dhh_fifo_block_decode(const uint8_t *buff, lis3dhh_block_t *blk,
+                               uint16_t num);
+void lis3dhh_block_xyz_get(const lis3dhh_block_t *blk, int16_t *xyz);
+void lis3dhh_block_xyz_set(lis3dhh_block_t *blk, const int16_t *xyz,
+                           uint16_t num);
+
 int32_t lis3dhh_auto_add_inc_set(stmdev_ctx_t *ctx, uint8_t val);
 int32_t lis3dhh_auto_add_inc_get(stmdev_ctx_t *ctx, uint8_t *val);
 
+typedef struct
+{
+  lis3dhh_ctrl_reg1_t    ctrl_reg1;
+  lis3dhh_int1_ctrl_t    int1_ctrl;
+  lis3dhh_int2_ctrl_t    int2_ctrl;
+  lis3dhh_ctrl_reg4_t    ctrl_reg4;
+  lis3dhh_ctrl_reg5_t    ctrl_reg5;
+  lis3dhh_fifo_ctrl_t    fifo_ctrl;
+} lis3dhh_config_t;
+int32_t lis3dhh_config_set(stmdev_ctx_t *ctx, const lis3dhh_config_t *val);
+int32_t lis3dhh_config_get(stmdev_ctx_t *ctx, lis3dhh_config_t *val);
+int32_t lis3dhh_config_apply_delta(stmdev_ctx_t *ctx,
+                                   const lis3dhh_config_t *from,
+                                   const lis3dhh_config_t *to,
+                                   uint8_t *num);
+
+/**
+  * @brief  Address / data line of a configuration table, checked at
+  *         compile time: a read-only register address does not compile.
+  *         e.g. const ucf_line_t cfg[] = { LIS3DHH_UCF_LINE(0x20, 0xC1) };
+  */
+#define LIS3DHH_UCF_REG_WRITABLE(addr)                              \
+  ((((addr) >= LIS3DHH_CTRL_REG1) && ((addr) <= LIS3DHH_CTRL_REG5)) || \
+   ((addr) == LIS3DHH_FIFO_CTRL))
+#define LIS3DHH_UCF_LINE(addr, val)                                 \
+  { (uint8_t)((addr) +                                              \
+              (0U * sizeof(char[LIS3DHH_UCF_REG_WRITABLE(addr) ? 1 : -1]))), \
+    (uint8_t)(val) }
+int32_t lis3dhh_ucf_load(stmdev_ctx_t *ctx, const ucf_line_t *ucf,
+                         uint16_t len);
+
+int32_t lis3dhh_reg_fields_set(stmdev_ctx_t *ctx, uint8_t reg,
+                               uint8_t mask, uint8_t val);
+int32_t lis3dhh_reg_fields_get(stmdev_ctx_t *ctx, uint8_t reg,
+                               uint8_t mask, uint8_t *val);
+
+/**
+  * @defgroup LIS3DHH_Sample_ring
+  * @brief    Single producer / single consumer queue of samples, to pass
+  *           data from the interrupt handler to the application without
+  *           locks. buff size MUST be a power of 2 (max 32768).
+  *
+  *           Only the producer writes head and ovr, only the consumer
+  *           writes tail. LIS3DHH_MEM_BARRIER() orders the sample copy
+  *           with respect to the index update: the default is fine for
+  *           GCC / Clang, other compilers or multi-core targets have to
+  *           define it (e.g. __DMB() on Cortex-M).
+  *           The producer fields (head, ovr) and the consumer one (tail)
+  *           are kept on separate cache lines with LIS3DHH_CACHE_ALIGN
+  *           (64 bytes on GCC / Clang); it can be defined empty on targets
+  *           without data cache to save RAM.
+  *
+  * @{
+  *
+  */
+
+#ifndef LIS3DHH_MEM_BARRIER
+#if defined(__GNUC__)
+#define LIS3DHH_MEM_BARRIER()   __sync_synchronize()
+#else
+#define LIS3DHH_MEM_BARRIER()
+#endif /* __GNUC__ */
+#endif /* LIS3DHH_MEM_BARRIER */
+
+#ifndef LIS3DHH_CACHE_ALIGN
+#if defined(__GNUC__)
+#define LIS3DHH_CACHE_ALIGN     __attribute__((aligned(64)))
+#else
+#define LIS3DHH_CACHE_ALIGN
+#endif /* __GNUC__ */
+#endif /* LIS3DHH_CACHE_ALIGN */
+
+typedef struct
+{
+  uint32_t timestamp;
+  int16_t xl[3];
+  lis3dhh_status_t status;
+} lis3dhh_sample_t;
+
+typedef struct
+{
+  lis3dhh_sample_t *buff;
+  uint16_t mask;
+  volatile uint16_t head;
+  volatile uint32_t ovr;
+  volatile uint16_t tail LIS3DHH_CACHE_ALIGN;
+} lis3dhh_ring_t;
+
+/**
+  * @}
+  *
+  */
+
+int32_t lis3dhh_ring_init(lis3dhh_ring_t *ring, lis3dhh_sample_t *buff,
+                          uint16_t size);
+int32_t lis3dhh_ring_push(lis3dhh_ring_t *ring,
+                          const lis3dhh_sample_t *val);
+uint16_t lis3dhh_ring_pop(lis3dhh_ring_t *ring, lis3dhh_sample_t *val,
+                          uint16_t max);
+uint16_t lis3dhh_ring_level_get(const lis3dhh_ring_t *ring);
+
+/**
+  * @defgroup LIS3DHH_FIFO_scheduler
+  * @brief    Drain planning for several devices sharing the same bus.
+  *           Each device FIFO level is estimated from the last drain and
+  *           the sample period, so the device closest to FIFO full is
+  *           selected without bus access.
+  *           Time is in any free running 32-bit unit chosen by the
+  *           application (e.g. us).
+  * @{
+  *
+  */
+
+typedef struct
+{
+  stmdev_ctx_t *ctx;
+  uint32_t period;
+  uint32_t last;
+  uint32_t late_max;
+  uint32_t ovr;
+  uint8_t level;
+  uint8_t headroom;
+} lis3dhh_sched_dev_t;
+
+/**
+  * @}
+  *
+  */
+
+int32_t lis3dhh_sched_init(lis3dhh_sched_dev_t *dev, stmdev_ctx_t *ctx,
+                           uint32_t period, uint32_t now);
+uint8_t lis3dhh_sched_level_get(const lis3dhh_sched_dev_t *dev,
+                                uint32_t now);
+uint8_t lis3dhh_sched_next(const lis3dhh_sched_dev_t *dev, uint8_t num,
+                           uint32_t now);
+int32_t lis3dhh_sched_drain(lis3dhh_sched_dev_t *dev, uint32_t now,
+                            int16_t *xyz, uint16_t max_samples,
+                            uint16_t *read);
+
+/**
+  * @defgroup LIS3DHH_FIFO_timestamp
+  * @brief    Per-sample timestamps of FIFO batches, back-computed from
+  *           the time FIFO_SRC is read and the number of stored samples.
+  *           The actual sample period (ODR drift against the host clock)
+  *           and the time of the newest sample are tracked by an
+  *           alpha-beta filter with gain 2^-gain.
+  *           Time is in any free running 32-bit unit chosen by the
+  *           application (e.g. us), period is in the same unit, Q16.
+  * @{
+  *
+  */
+
+typedef struct
+{
+  uint32_t nominal;
+  uint32_t period;
+  uint32_t t_newest;
+  uint32_t newest;
+  uint32_t drained;
+  uint8_t gain;
+  uint8_t valid;
+} lis3dhh_ts_t;
+
+/**
+  * @}
+  *
+  */
+
+int32_t lis3dhh_ts_init(lis3dhh_ts_t *ts, uint32_t period, uint8_t gain);
+void lis3dhh_ts_update(lis3dhh_ts_t *ts, uint32_t t,
+                       const lis3dhh_fifo_src_t *status, uint16_t read,
+                       uint32_t *stamps);
+int32_t lis3dhh_ts_drift_get(const lis3dhh_ts_t *ts);
+
+/**
+  * @defgroup LIS3DHH_Decimation
+  * @brief    Streaming CIC (cascaded integrator-comb) decimator for X, Y,
+  *           Z raw data, e.g. to average FIFO batches down to 1..10 Hz
+  *           for inclinometer use. Integer only: the output is the mean
+  *           of the CIC window in LSB, Q8 (1/256 LSB), so the resolution
+  *           gained by oversampling is kept.
+  *           ratio^order MUST NOT exceed 2^32.
+  * @{
+  *
+  */
+
+#define LIS3DHH_CIC_MAX_ORDER   4U
+
+typedef struct
+{
+  uint64_t integ[LIS3DHH_CIC_MAX_ORDER][3];
+  uint64_t comb[LIS3DHH_CIC_MAX_ORDER][3];
+  uint64_t gain;
+  uint16_t ratio;
+  uint16_t phase;
+  uint8_t order;
+} lis3dhh_cic_t;
+
+/**
+  * @}
+  *
+  */
+
+int32_t lis3dhh_cic_init(lis3dhh_cic_t *cic, uint8_t order,
+                         uint16_t ratio);
+uint16_t lis3dhh_cic_process(lis3dhh_cic_t *cic, const int16_t *xyz,
+                             uint16_t num, int32_t *out);
+
+/**
+  * @defgroup LIS3DHH_Inclination
+  * @brief    Pitch, roll and tilt from vertical of X, Y, Z raw data
+  *           batches, computed on the raw values (angles only depend on
+  *           axis ratios). Arc tangent accuracy is selected per call,
+  *           errors are measured against double precision atan2.
+  *
+  *           The functions are compiled in only if LIS3DHH_INCLINATION is
+  *           defined; they use sqrtf (and atan2f for LIS3DHH_ATAN_LIBM),
+  *           so the math library must then be linked.
+  * @{
+  *
+  */
+
+typedef enum
+{
+  LIS3DHH_ATAN_LIBM    = 0,  /* atan2f from math library */
+  LIS3DHH_ATAN_POLY    = 1,  /* max error 0.001 deg */
+  LIS3DHH_ATAN_FAST    = 2,  /* max error 0.25 deg */
+} lis3dhh_atan_t;
+
+/**
+  * @}
+  *
+  */
+
+#if defined(LIS3DHH_INCLINATION)
+void lis3dhh_tilt_array(const int16_t *xyz, size_t n, lis3dhh_atan_t mode,
+                        float_t *pitch, float_t *roll, float_t *tilt);
+#endif /* LIS3DHH_INCLINATION */
+
+/**
+  * @defgroup LIS3DHH_Temperature_compensation
+  * @brief    Per axis offset and gain drift versus temperature, as
+  *           polynomials of (T - t_ref), applied to X, Y, Z raw data
+  *           batches. Temperature is only read at the batch ends and the
+  *           coefficients are interpolated in between.
+  * @{
+  *
+  */
+
+#define LIS3DHH_TCOMP_ORDER   3U
+
+typedef struct
+{
+  float_t t_ref;                          /* Celsius */
+  float_t off[3][LIS3DHH_TCOMP_ORDER];    /* mg, vs (T - t_ref)^k */
+  float_t gain[3][LIS3DHH_TCOMP_ORDER];   /* relative error, vs (T - t_ref)^k */
+} lis3dhh_tcomp_t;
+
+/**
+  * @}
+  *
+  */
+
+void lis3dhh_tcomp_apply(const lis3dhh_tcomp_t *tc, int16_t t_first,
+                         int16_t t_last, const int16_t *xyz, size_t n,
+                         float_t *mg);
+void lis3dhh_tcomp_apply_ug(const lis3dhh_tcomp_t *tc, int16_t t_first,
+                            int16_t t_last, const int16_t *xyz, size_t n,
+                            int32_t *ug);
+
+/**
+  * @defgroup LIS3DHH_Calibration
+  * @brief    Offset, gain and misalignment calibration, mg = M * raw +
+  *           off, estimated by least squares from averaged static poses
+  *           with known orientation (at least four, non coplanar) and
+  *           stored in a LIS3DHH_CALIB_BLOB_LEN bytes blob.
+  * @{
+  *
+  */
+
+#define LIS3DHH_CALIB_BLOB_LEN   26U
+
+typedef struct
+{
+  float_t ata[4][4];
+  float_t atb[4][3];
+  uint16_t num;
+} lis3dhh_calib_acc_t;
+
+typedef struct
+{
+  float_t m[3][3];    /* mg/LSB */
+  float_t off[3];     /* mg */
+} lis3dhh_calib_t;
+
+/**
+  * @}
+  *
+  */
+
+void lis3dhh_calib_average(const int16_t *xyz, size_t n, float_t *avg);
+void lis3dhh_calib_acc_init(lis3dhh_calib_acc_t *acc);
+void lis3dhh_calib_acc_add(lis3dhh_calib_acc_t *acc, const float_t *raw,
+                           const float_t *ref);
+int32_t lis3dhh_calib_solve(const lis3dhh_calib_acc_t *acc,
+                            lis3dhh_calib_t *cal);
+void lis3dhh_calib_apply(const lis3dhh_calib_t *cal, const int16_t *xyz,
+                         size_t n, float_t *mg);
+int32_t lis3dhh_calib_pack(const lis3dhh_calib_t *cal, uint8_t *buff);
+int32_t lis3dhh_calib_unpack(const uint8_t *buff, lis3dhh_calib_t *cal);
+
+/**
+  * @defgroup LIS3DHH_Compression
+  * @brief    Lossless block codec for X, Y, Z raw data: difference from
+  *           the previous sample, zigzag coding and bit packing with one
+  *           width per axis and block. Keyframes, written every
+  *           key_interval blocks, allow to start decoding mid stream.
+  * @{
+  *
+  */
+
+#define LIS3DHH_PACK_BLOCK     32U
+#define LIS3DHH_PACK_MAX_LEN   (7U + (3U * (1U + ((LIS3DHH_PACK_BLOCK * 17U) + 7U) / 8U)))
+
+typedef struct
+{
+  int16_t prev[3];
+  uint16_t key_interval;
+  uint16_t cnt;
+  uint8_t valid;
+} lis3dhh_pack_t;
+
+/**
+  * @}
+  *
+  */
+
+void lis3dhh_pack_init(lis3dhh_pack_t *pk, uint16_t key_interval);
+uint16_t lis3dhh_pack_encode(lis3dhh_pack_t *pk, const int16_t *xyz,
+                             uint8_t num, uint8_t *buff);
+int32_t lis3dhh_pack_decode(lis3dhh_pack_t *pk, const uint8_t *buff,
+                            uint16_t len, int16_t *xyz, uint8_t *num,
+                            uint16_t *used);
+
+/**
+  * @defgroup LIS3DHH_Health_monitor
+  * @brief    Counters of data path anomalies, updated from the STATUS /
+  *           FIFO_SRC bytes and samples the application already reads
+  *           (lis3dhh_snapshot_raw_get, lis3dhh_fifo_data_status_get),
+  *           so they cost no bus transaction.
+  *           Lost samples are a lower bound: an overrun flag means that
+  *           at least one sample was overwritten.
+  * @{
+  *
+  */
+
+#define LIS3DHH_HEALTH_STUCK    16U
+
+typedef struct
+{
+  uint32_t samples;       /* samples checked */
+  uint32_t stale;         /* samples read again, zyxda not set in STATUS */
+  uint32_t lost;          /* samples lost, lower bound */
+  uint32_t xl_ovr;        /* zyxor set in STATUS */
+  uint32_t fifo_ovr;      /* ovrn set in FIFO_SRC */
+  uint32_t fth;           /* fth set in FIFO_SRC */
+  uint32_t repeated;      /* samples equal to the previous one */
+  uint32_t stuck;         /* axis unchanged for LIS3DHH_HEALTH_STUCK samples */
+  uint32_t saturated;     /* axis at -32768 or 32767 */
+  uint32_t latency_max;   /* max time between two updates */
+} lis3dhh_health_cnt_t;
+
+typedef struct
+{
+  lis3dhh_health_cnt_t cnt;
+  volatile uint32_t seq;
+  uint32_t last;
+  int16_t prev[3];
+  uint16_t run[3];
+  uint8_t valid;
+} lis3dhh_health_t;
+
+/**
+  * @}
+  *
+  */
+
+void lis3dhh_health_init(lis3dhh_health_t *h);
+void lis3dhh_health_status_update(lis3dhh_health_t *h,
+                                  const lis3dhh_status_t *status,
+                                  const int16_t *xyz, uint32_t now);
+void lis3dhh_health_fifo_update(lis3dhh_health_t *h,
+                                const lis3dhh_fifo_src_t *status,
+                                const int16_t *xyz, uint16_t read,
+                                uint32_t now);
+void lis3dhh_health_get(const lis3dhh_health_t *h,
+                        lis3dhh_health_cnt_t *val);
+
 /**
   *@}
   *